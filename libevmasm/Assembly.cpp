@@ -332,6 +332,14 @@ AssemblyItem Assembly::newImmutableAssignment(std::string const& _identifier)
 	return AssemblyItem{AssignImmutable, h};
 }
 
+std::shared_ptr<Assembly> Assembly::deepCopy() const
+{
+	auto copy = std::make_shared<Assembly>(*this);
+	for (auto& sub: copy->m_subs)
+		sub = sub->deepCopy();
+	return copy;
+}
+
 Assembly& Assembly::optimise(OptimiserSettings const& _settings)
 {
 	optimiseInternal(_settings, {});
@@ -163,6 +163,10 @@ public:
 
 	bool isCreation() const { return m_creation; }
 
+	/// @returns a copy of this assembly that, unlike a plain copy, does not share its sub-assemblies
+	/// with the original, so that it can be optimised and assembled independently.
+	std::shared_ptr<Assembly> deepCopy() const;
+
 protected:
 	/// Does the same operations as @a optimise, but should only be applied to a sub and
 	/// returns the replaced tags. Also takes an argument containing the tags of this assembly
@@ -25,8 +25,10 @@
 #include <libsolutil/Numeric.h>
 #include <libsolutil/StringUtils.h>
 #include <libsolutil/FixedHash.h>
+#include <libsolutil/LEB128.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <charconv>
 #include <fstream>
 #include <limits>
 
@@ -411,51 +413,74 @@ size_t AssemblyItem::opcodeCount() const noexcept
 	}
 }
 
-std::string AssemblyItem::computeSourceMapping(
+template<typename Callback>
+void AssemblyItem::forEachSourceMappingEntry(
 	AssemblyItems const& _items,
-	std::map<std::string, unsigned> const& _sourceIndicesMap
+	std::map<std::string, unsigned> const& _sourceIndicesMap,
+	Callback const& _callback
 )
 {
-	std::string ret;
-
-	int prevStart = -1;
-	int prevLength = -1;
-	int prevSourceIndex = -1;
-	int prevModifierDepth = -1;
-	char prevJump = 0;
-
+	// Consecutive items mostly share their source, so its index is only looked up when it changes.
+	std::string const* sourceName = nullptr;
+	int sourceIndex = -1;
 	for (auto const& item: _items)
 	{
-		if (!ret.empty())
-			ret += ";";
-
 		SourceLocation const& location = item.location();
-		int length = location.start != -1 && location.end != -1 ? location.end - location.start : -1;
-		int sourceIndex =
-			(location.sourceName && _sourceIndicesMap.count(*location.sourceName)) ?
-			static_cast<int>(_sourceIndicesMap.at(*location.sourceName)) :
-			-1;
-		char jump = '-';
+		if (location.sourceName.get() != sourceName)
+		{
+			sourceName = location.sourceName.get();
+			auto index = sourceName ? _sourceIndicesMap.find(*sourceName) : _sourceIndicesMap.end();
+			sourceIndex = index != _sourceIndicesMap.end() ? static_cast<int>(index->second) : -1;
+		}
+
+		SourceMappingEntry entry;
+		entry.start = location.start;
+		entry.length = location.start != -1 && location.end != -1 ? location.end - location.start : -1;
+		entry.sourceIndex = sourceIndex;
+		entry.jump = '-';
 		if (item.getJumpType() == evmasm::AssemblyItem::JumpType::IntoFunction)
-			jump = 'i';
+			entry.jump = 'i';
 		else if (item.getJumpType() == evmasm::AssemblyItem::JumpType::OutOfFunction)
-			jump = 'o';
-		int modifierDepth = static_cast<int>(item.m_modifierDepth);
+			entry.jump = 'o';
+		entry.modifierDepth = static_cast<int>(item.m_modifierDepth);
+		_callback(entry, item.opcodeCount());
+	}
+}
+
+std::string AssemblyItem::computeSourceMapping(
+	AssemblyItems const& _items,
+	std::map<std::string, unsigned> const& _sourceIndicesMap
+)
+{
+	std::string ret;
+	// Most entries are empty or consist of a few characters only.
+	ret.reserve(4 * _items.size());
+	auto appendNumber = [&](int _value) {
+		char buffer[std::numeric_limits<int>::digits10 + 2];
+		ret.append(buffer, std::to_chars(std::begin(buffer), std::end(buffer), _value).ptr);
+	};
+
+	SourceMappingEntry prev;
+	bool first = true;
+	forEachSourceMappingEntry(_items, _sourceIndicesMap, [&](SourceMappingEntry const& _entry, size_t _opcodeCount) {
+		if (!first)
+			ret += ';';
+		first = false;
 
 		unsigned components = 5;
-		if (modifierDepth == prevModifierDepth)
+		if (_entry.modifierDepth == prev.modifierDepth)
 		{
 			components--;
-			if (jump == prevJump)
+			if (_entry.jump == prev.jump)
 			{
 				components--;
-				if (sourceIndex == prevSourceIndex)
+				if (_entry.sourceIndex == prev.sourceIndex)
 				{
 					components--;
-					if (length == prevLength)
+					if (_entry.length == prev.length)
 					{
 						components--;
-						if (location.start == prevStart)
+						if (_entry.start == prev.start)
 							components--;
 					}
 				}
@@ -464,42 +489,82 @@ std::string AssemblyItem::computeSourceMapping(
 
 		if (components-- > 0)
 		{
-			if (location.start != prevStart)
-				ret += std::to_string(location.start);
+			if (_entry.start != prev.start)
+				appendNumber(_entry.start);
 			if (components-- > 0)
 			{
 				ret += ':';
-				if (length != prevLength)
-					ret += std::to_string(length);
+				if (_entry.length != prev.length)
+					appendNumber(_entry.length);
 				if (components-- > 0)
 				{
 					ret += ':';
-					if (sourceIndex != prevSourceIndex)
-						ret += std::to_string(sourceIndex);
+					if (_entry.sourceIndex != prev.sourceIndex)
+						appendNumber(_entry.sourceIndex);
 					if (components-- > 0)
 					{
 						ret += ':';
-						if (jump != prevJump)
-							ret += jump;
+						if (_entry.jump != prev.jump)
+							ret += _entry.jump;
 						if (components-- > 0)
 						{
 							ret += ':';
-							if (modifierDepth != prevModifierDepth)
-								ret += std::to_string(modifierDepth);
+							if (_entry.modifierDepth != prev.modifierDepth)
+								appendNumber(_entry.modifierDepth);
 						}
 					}
 				}
 			}
 		}
 
-		if (item.opcodeCount() > 1)
-			ret += std::string(item.opcodeCount() - 1, ';');
+		if (_opcodeCount > 1)
+			ret.append(_opcodeCount - 1, ';');
 
-		prevStart = location.start;
-		prevLength = length;
-		prevSourceIndex = sourceIndex;
-		prevJump = jump;
-		prevModifierDepth = modifierDepth;
-	}
+		prev = _entry;
+	});
+	return ret;
+}
+
+bytes AssemblyItem::computeBinarySourceMapping(
+	AssemblyItems const& _items,
+	std::map<std::string, unsigned> const& _sourceIndicesMap
+)
+{
+	bytes ret;
+	ret.reserve(2 * _items.size());
+
+	SourceMappingEntry prev;
+	forEachSourceMappingEntry(_items, _sourceIndicesMap, [&](SourceMappingEntry const& _entry, size_t _opcodeCount) {
+		uint8_t jump = 0;
+		if (_entry.jump == 'i')
+			jump = 0x10;
+		else if (_entry.jump == 'o')
+			jump = 0x20;
+		uint8_t header = jump;
+		if (_entry.start != prev.start)
+			header |= 0x01;
+		if (_entry.length != prev.length)
+			header |= 0x02;
+		if (_entry.sourceIndex != prev.sourceIndex)
+			header |= 0x04;
+		if (_entry.modifierDepth != prev.modifierDepth)
+			header |= 0x08;
+
+		ret.push_back(header);
+		if (_entry.start != prev.start)
+			util::lebEncodeSigned(int64_t(_entry.start) - int64_t(prev.start), ret);
+		if (_entry.length != prev.length)
+			util::lebEncodeSigned(_entry.length, ret);
+		if (_entry.sourceIndex != prev.sourceIndex)
+			util::lebEncodeSigned(_entry.sourceIndex, ret);
+		if (_entry.modifierDepth != prev.modifierDepth)
+			util::lebEncodeSigned(_entry.modifierDepth, ret);
+
+		// Further opcodes of the same item have the same entry.
+		if (_opcodeCount > 1)
+			ret.insert(ret.end(), _opcodeCount - 1, jump);
+
+		prev = _entry;
+	});
 	return ret;
 }
@@ -156,6 +156,19 @@ public:
 		AssemblyItems const& _items,
 		std::map<std::string, unsigned> const& _sourceIndicesMap
 	);
+	/// @returns the source mapping of @a _items in a binary format that contains the same
+	/// information as the one returned by computeSourceMapping, but is more compact and
+	/// faster to decode.
+	/// There is one entry per opcode. Each entry starts with a byte whose bits 0 to 3 are set
+	/// if the source offset, length, source index and modifier depth, respectively, differ
+	/// from the previous entry, and whose bits 4 and 5 contain the jump type (0 for "-",
+	/// 1 for "i", 2 for "o"). The byte is followed by the changed values in that order, each
+	/// encoded as a signed LEB128 number. The source offset is encoded as the difference to
+	/// the previous one. All values are -1 before the first entry.
+	static bytes computeBinarySourceMapping(
+		AssemblyItems const& _items,
+		std::map<std::string, unsigned> const& _sourceIndicesMap
+	);
 
 	/// @returns an upper bound for the number of bytes required by this item, assuming that
 	/// the value of a jump tag takes @a _addressLength bytes.
@@ -187,6 +200,23 @@ public:
 	void setImmutableOccurrences(size_t _n) const { m_immutableOccurrences = _n; }
 
 private:
+	/// Fields of an entry of a source mapping.
+	struct SourceMappingEntry
+	{
+		int start = -1;
+		int length = -1;
+		int sourceIndex = -1;
+		char jump = 0;
+		int modifierDepth = -1;
+	};
+	/// Calls @a _callback with the source mapping entry and the number of opcodes of each of @a _items.
+	template<typename Callback>
+	static void forEachSourceMappingEntry(
+		AssemblyItems const& _items,
+		std::map<std::string, unsigned> const& _sourceIndicesMap,
+		Callback const& _callback
+	);
+
 	size_t opcodeCount() const noexcept;
 
 	AssemblyItemType m_type;
@@ -51,6 +51,8 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <algorithm>
+
 using namespace solidity;
 using namespace solidity::langutil;
 
@@ -81,19 +83,19 @@ char CharStream::setPosition(size_t _location)
 std::string CharStream::lineAtPosition(int _position) const
 {
 	// if _position points to \n, it returns the line before the \n
-	using size_type = std::string::size_type;
+	using size_type = std::string_view::size_type;
 	size_type searchStart = std::min<size_type>(m_source.size(), size_type(_position));
 	if (searchStart > 0)
 		searchStart--;
 	size_type lineStart = m_source.rfind('\n', searchStart);
-	if (lineStart == std::string::npos)
+	if (lineStart == std::string_view::npos)
 		lineStart = 0;
 	else
 		lineStart++;
-	std::string line = m_source.substr(
+	std::string line{m_source.substr(
 		lineStart,
 		std::min(m_source.find('\n', lineStart), m_source.size()) - lineStart
-	);
+	)};
 	if (!line.empty() && line.back() == '\r')
 		line.pop_back();
 	return line;
@@ -101,17 +103,17 @@ std::string CharStream::lineAtPosition(int _position) const
 
 LineColumn CharStream::translatePositionToLineColumn(int _position) const
 {
-	using size_type = std::string::size_type;
-	using diff_type = std::string::difference_type;
+	using size_type = std::string_view::size_type;
+	using diff_type = std::string_view::difference_type;
 	size_type searchPosition = std::min<size_type>(m_source.size(), size_type(_position));
-	int lineNumber = static_cast<int>(count(m_source.begin(), m_source.begin() + diff_type(searchPosition), '\n'));
+	int lineNumber = static_cast<int>(std::count(m_source.begin(), m_source.begin() + diff_type(searchPosition), '\n'));
 	size_type lineStart;
 	if (searchPosition == 0)
 		lineStart = 0;
 	else
 	{
 		lineStart = m_source.rfind('\n', searchPosition - 1);
-		lineStart = lineStart == std::string::npos ? 0 : lineStart + 1;
+		lineStart = lineStart == std::string_view::npos ? 0 : lineStart + 1;
 	}
 	return LineColumn{lineNumber, static_cast<int>(searchPosition - lineStart)};
 }
@@ -122,13 +124,13 @@ std::string_view CharStream::text(SourceLocation const& _location) const
 		return {};
 	solAssert(_location.sourceName && *_location.sourceName == m_name, "");
 	solAssert(static_cast<size_t>(_location.end) <= m_source.size(), "");
-	return std::string_view{m_source}.substr(
+	return m_source.substr(
 		static_cast<size_t>(_location.start),
 		static_cast<size_t>(_location.end - _location.start)
 	);
 }
 
-std::string CharStream::singleLineSnippet(std::string const& _sourceCode, SourceLocation const& _location)
+std::string CharStream::singleLineSnippet(std::string_view _sourceCode, SourceLocation const& _location)
 {
 	if (!_location.hasText())
 		return {};
@@ -136,12 +138,12 @@ std::string CharStream::singleLineSnippet(std::string const& _sourceCode, Source
 	if (static_cast<size_t>(_location.start) >= _sourceCode.size())
 		return {};
 
-	std::string cut = _sourceCode.substr(static_cast<size_t>(_location.start), static_cast<size_t>(_location.end - _location.start));
+	std::string_view cut = _sourceCode.substr(static_cast<size_t>(_location.start), static_cast<size_t>(_location.end - _location.start));
 	auto newLinePos = cut.find_first_of("\n\r");
-	if (newLinePos != std::string::npos)
-		cut = cut.substr(0, newLinePos) + "...";
+	if (newLinePos != std::string_view::npos)
+		return std::string{cut.substr(0, newLinePos)} + "...";
 
-	return cut;
+	return std::string{cut};
 }
 
 std::optional<int> CharStream::translateLineColumnToPosition(LineColumn const& _lineColumn) const
@@ -149,7 +151,7 @@ std::optional<int> CharStream::translateLineColumnToPosition(LineColumn const& _
 	return translateLineColumnToPosition(m_source, _lineColumn);
 }
 
-std::optional<int> CharStream::translateLineColumnToPosition(std::string const& _text, LineColumn const& _input)
+std::optional<int> CharStream::translateLineColumnToPosition(std::string_view _text, LineColumn const& _input)
 {
 	if (_input.line < 0)
 		return std::nullopt;
@@ -164,7 +166,7 @@ std::optional<int> CharStream::translateLineColumnToPosition(std::string const&
 	}
 
 	size_t endOfLine = _text.find('\n', offset);
-	if (endOfLine == std::string::npos)
+	if (endOfLine == std::string_view::npos)
 		endOfLine = _text.size();
 
 	if (offset + static_cast<size_t>(_input.column) > endOfLine)
@@ -50,9 +50,13 @@
 
 #pragma once
 
+#include <libsolutil/SourceBuffer.h>
+
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
 
@@ -66,15 +70,21 @@ struct LineColumn;
  * Bidirectional stream of characters.
  *
  * This CharStream is used by lexical analyzers as the source.
+ * The source text is held in a shared, immutable buffer, so copies of a stream are cheap and
+ * a buffer loaded by the file reader can be scanned without copying it.
  */
 class CharStream
 {
 public:
 	CharStream() = default;
 	CharStream(std::string _source, std::string _name):
-		m_source(std::move(_source)), m_name(std::move(_name)) {}
+		CharStream(std::make_shared<util::SourceBuffer const>(std::move(_source)), std::move(_name)) {}
 	CharStream(std::string _source, std::string _name, bool _importedFromAST):
-		m_source(std::move(_source)),
+		CharStream(std::make_shared<util::SourceBuffer const>(std::move(_source)), std::move(_name), _importedFromAST)
+	{ }
+	CharStream(std::shared_ptr<util::SourceBuffer const> _buffer, std::string _name, bool _importedFromAST = false):
+		m_buffer(std::move(_buffer)),
+		m_source(m_buffer->view()),
 		m_name(std::move(_name)),
 		m_importedFromAST(_importedFromAST)
 	{ }
@@ -95,7 +105,9 @@ public:
 
 	void reset() { m_position = 0; }
 
-	std::string const& source() const noexcept { return m_source; }
+	std::string_view source() const noexcept { return m_source; }
+	/// @returns the buffer holding the source text. Null for a default-constructed stream.
+	std::shared_ptr<util::SourceBuffer const> const& buffer() const noexcept { return m_buffer; }
 	std::string const& name() const noexcept { return m_name; }
 
 	size_t size() const { return m_source.size(); }
@@ -112,7 +124,7 @@ public:
 	std::optional<int> translateLineColumnToPosition(LineColumn const& _lineColumn) const;
 
 	/// Translates a line:column to the absolute position for the given input text.
-	static std::optional<int> translateLineColumnToPosition(std::string const& _text, LineColumn const& _input);
+	static std::optional<int> translateLineColumnToPosition(std::string_view _text, LineColumn const& _input);
 
 	/// Tests whether or not given octet sequence is present at the current position in stream.
 	/// @returns true if the sequence could be found, false otherwise.
@@ -139,10 +151,11 @@ public:
 		return singleLineSnippet(m_source, _location);
 	}
 
-	static std::string singleLineSnippet(std::string const& _sourceCode, SourceLocation const& _location);
+	static std::string singleLineSnippet(std::string_view _sourceCode, SourceLocation const& _location);
 
 private:
-	std::string m_source;
+	std::shared_ptr<util::SourceBuffer const> m_buffer;
+	std::string_view m_source;
 	std::string m_name;
 	bool m_importedFromAST{false};
 	size_t m_position{0};
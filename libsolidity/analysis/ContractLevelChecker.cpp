@@ -39,14 +39,6 @@ using namespace solidity::frontend;
 namespace
 {
 
-template <class T, class B>
-bool hasEqualExternalCallableParameters(T const& _a, B const& _b)
-{
-	return FunctionType(_a).asExternallyCallableFunction(false)->hasEqualParameterTypes(
-		*FunctionType(_b).asExternallyCallableFunction(false)
-	);
-}
-
 template<typename T>
 std::map<ASTString, std::vector<T const*>> filterDeclarations(
 	std::map<ASTString, std::vector<Declaration const*>> const& _declarations)
@@ -193,6 +185,15 @@ void ContractLevelChecker::checkReceiveFunction(ContractDefinition const& _contr
 	}
 }
 
+template <class T>
+FunctionType const* ContractLevelChecker::externallyCallableType(T const& _declaration)
+{
+	auto [it, inserted] = m_externallyCallableTypes.try_emplace(&_declaration, nullptr);
+	if (inserted)
+		it->second = FunctionType(_declaration).asExternallyCallableFunction(false);
+	return it->second;
+}
+
 template <class T>
 void ContractLevelChecker::findDuplicateDefinitions(std::map<std::string, std::vector<T>> const& _definitions)
 {
@@ -205,7 +206,9 @@ void ContractLevelChecker::findDuplicateDefinitions(std::map<std::string, std::v
 			SecondarySourceLocation ssl;
 
 			for (size_t j = i + 1; j < overloads.size(); ++j)
-				if (hasEqualExternalCallableParameters(*overloads[i], *overloads[j]))
+				if (externallyCallableType(*overloads[i])->hasEqualParameterTypes(
+					*externallyCallableType(*overloads[j])
+				))
 				{
 					solAssert(
 						(
@@ -259,13 +262,16 @@ void ContractLevelChecker::checkAbstractDefinitions(ContractDefinition const& _c
 	// override (unimplemented) base class ones, they are replaced.
 	std::set<OverrideProxy, OverrideProxy::CompareBySignature> proxies;
 
-	auto registerProxy = [&proxies](OverrideProxy const& _overrideProxy)
+	auto registerProxy = [&](OverrideProxy const& _item)
 	{
+		// Use the proxy cached by the override checker, which has its comparator precomputed.
+		OverrideProxy const& overrideProxy = m_overrideChecker.proxy(_item);
+
 		// Overwrite an existing proxy, if it exists.
-		if (!_overrideProxy.unimplemented())
-			proxies.erase(_overrideProxy);
+		if (!overrideProxy.unimplemented())
+			proxies.erase(overrideProxy);
 
-		proxies.insert(_overrideProxy);
+		proxies.insert(overrideProxy);
 	};
 
 	// Search from base to derived, collect all functions and modifiers and
@@ -517,14 +523,17 @@ void ContractLevelChecker::checkBaseABICompatibility(ContractDefinition const& _
 		if (!*func.second->declaration().sourceUnit().annotation().useABICoderV2)
 			continue;
 
-		auto const& currentLoc = func.second->declaration().location();
+		auto [it, inserted] = m_requiresABICoderV2.try_emplace(&func.second->declaration(), false);
+		if (inserted)
+			for (Type const* paramType: func.second->parameterTypes() + func.second->returnParameterTypes())
+				if (!TypeChecker::typeSupportedByOldABIEncoder(*paramType, false))
+				{
+					it->second = true;
+					break;
+				}
 
-		for (Type const* paramType: func.second->parameterTypes() + func.second->returnParameterTypes())
-			if (!TypeChecker::typeSupportedByOldABIEncoder(*paramType, false))
-			{
-				errors.append("Type only supported by ABIEncoderV2", currentLoc);
-				break;
-			}
+		if (it->second)
+			errors.append("Type only supported by ABIEncoderV2", func.second->declaration().location());
 	}
 
 	if (!errors.infos.empty())
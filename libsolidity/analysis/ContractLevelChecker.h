@@ -66,6 +66,9 @@ private:
 	void checkReceiveFunction(ContractDefinition const& _contract);
 	template <class T>
 	void findDuplicateDefinitions(std::map<std::string, std::vector<T>> const& _definitions);
+	/// @returns the externally callable function type of @a _declaration, cached across contracts.
+	template <class T>
+	FunctionType const* externallyCallableType(T const& _declaration);
 	/// Checks for unimplemented functions and modifiers.
 	void checkAbstractDefinitions(ContractDefinition const& _contract);
 	/// Checks that the base constructor arguments are properly provided.
@@ -93,6 +96,12 @@ private:
 
 	OverrideChecker m_overrideChecker;
 	langutil::ErrorReporter& m_errorReporter;
+
+	/// Cache for externallyCallableType().
+	std::map<Declaration const*, FunctionType const*> m_externallyCallableTypes;
+	/// Caches whether a function in an interface function list requires ABI coder v2.
+	/// Shared by all contracts that inherit the function.
+	std::map<Declaration const*, bool> m_requiresABICoderV2;
 };
 
 }
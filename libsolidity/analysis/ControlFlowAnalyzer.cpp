@@ -17,13 +17,14 @@
 // SPDX-License-Identifier: GPL-3.0
 
 #include <libsolidity/analysis/ControlFlowAnalyzer.h>
+#include <libsolidity/analysis/ControlFlowDataFlow.h>
 
 #include <liblangutil/SourceLocation.h>
-#include <libsolutil/Algorithms.h>
 
 #include <range/v3/algorithm/sort.hpp>
 
 #include <functional>
+#include <unordered_map>
 
 using namespace std::placeholders;
 using namespace solidity::langutil;
@@ -62,47 +63,49 @@ void ControlFlowAnalyzer::analyze(FunctionDefinition const& _function, ContractD
 
 void ControlFlowAnalyzer::checkUninitializedAccess(CFGNode const* _entry, CFGNode const* _exit, bool _emptyBody, std::optional<std::string> _contractName)
 {
-	struct NodeInfo
+	// Densely index the variables declared in the function and the occurrences that read them.
+	// The facts of the data-flow analysis are the unassigned variables, followed by the accesses
+	// that may happen while the variable is unassigned.
+	CFGNodeOrder order({_entry}, CFGNodeOrder::Direction::Forward);
+	std::unordered_map<VariableDeclaration const*, size_t> variableIndices;
+	std::vector<VariableOccurrence const*> accesses;
+	for (CFGNode const* node: order.nodes())
+		for (auto const& variableOccurrence: node->variableOccurrences)
+			if (variableOccurrence.kind() == VariableOccurrence::Kind::Declaration)
+				variableIndices.emplace(&variableOccurrence.declaration(), variableIndices.size());
+
+	struct Operation
 	{
-		std::set<VariableDeclaration const*> unassignedVariablesAtEntry;
-		std::set<VariableDeclaration const*> unassignedVariablesAtExit;
-		std::set<VariableOccurrence const*> uninitializedVariableAccesses;
-		/// Propagate the information from another node to this node.
-		/// To be used to propagate information from a node to its exit nodes.
-		/// Returns true, if new variables were added and thus the current node has
-		/// to be traversed again.
-		bool propagateFrom(NodeInfo const& _entryNode)
+		VariableOccurrence::Kind kind;
+		size_t variable;
+		size_t access;
+	};
+	std::vector<std::vector<Operation>> nodeOperations(order.nodes().size());
+	for (size_t node = 0; node < order.nodes().size(); ++node)
+		for (auto const& variableOccurrence: order.nodes()[node]->variableOccurrences)
 		{
-			size_t previousUnassignedVariablesAtEntry = unassignedVariablesAtEntry.size();
-			size_t previousUninitializedVariableAccessess = uninitializedVariableAccesses.size();
-			unassignedVariablesAtEntry += _entryNode.unassignedVariablesAtExit;
-			uninitializedVariableAccesses += _entryNode.uninitializedVariableAccesses;
-			return
-				unassignedVariablesAtEntry.size() > previousUnassignedVariablesAtEntry ||
-				uninitializedVariableAccesses.size() > previousUninitializedVariableAccessess
-			;
+			// Variables that are never declared in the function can never be unassigned.
+			auto variable = variableIndices.find(&variableOccurrence.declaration());
+			if (variable == variableIndices.end())
+				continue;
+			size_t access = 0;
+			if (
+				variableOccurrence.kind() != VariableOccurrence::Kind::Assignment &&
+				variableOccurrence.kind() != VariableOccurrence::Kind::Declaration
+			)
+			{
+				access = variableIndices.size() + accesses.size();
+				accesses.emplace_back(&variableOccurrence);
+			}
+			nodeOperations[node].push_back({variableOccurrence.kind(), variable->second, access});
 		}
-	};
-	std::map<CFGNode const*, NodeInfo> nodeInfos;
-	std::set<CFGNode const*> nodesToTraverse;
-	nodesToTraverse.insert(_entry);
-
-	// Walk all paths starting from the nodes in ``nodesToTraverse`` until ``NodeInfo::propagateFrom``
-	// returns false for all exits, i.e. until all paths have been walked with maximal sets of unassigned
-	// variables and accesses.
-	while (!nodesToTraverse.empty())
-	{
-		CFGNode const* currentNode = *nodesToTraverse.begin();
-		nodesToTraverse.erase(nodesToTraverse.begin());
 
-		auto& nodeInfo = nodeInfos[currentNode];
-		auto unassignedVariables = nodeInfo.unassignedVariablesAtEntry;
-		for (auto const& variableOccurrence: currentNode->variableOccurrences)
-		{
-			switch (variableOccurrence.kind())
+	BitVectorDataFlow dataFlow(order, variableIndices.size() + accesses.size(), [&](size_t _node, IndexSet& _state) {
+		for (Operation const& operation: nodeOperations[_node])
+			switch (operation.kind)
 			{
 				case VariableOccurrence::Kind::Assignment:
-					unassignedVariables.erase(&variableOccurrence.declaration());
+					_state.erase(operation.variable);
 					break;
 				case VariableOccurrence::Kind::InlineAssembly:
 					// We consider all variables referenced in inline assembly as accessed.
@@ -110,37 +113,27 @@ void ControlFlowAnalyzer::checkUninitializedAccess(CFGNode const* _entry, CFGNod
 					// the control flow in the assembly at some point.
 				case VariableOccurrence::Kind::Access:
 				case VariableOccurrence::Kind::Return:
-					if (unassignedVariables.count(&variableOccurrence.declaration()))
-					{
-						// Merely store the unassigned access. We do not generate an error right away, since this
-						// path might still always revert. It is only an error if this is propagated to the exit
-						// node of the function (i.e. there is a path with an uninitialized access).
-						nodeInfo.uninitializedVariableAccesses.insert(&variableOccurrence);
-					}
+					// Merely store the unassigned access. We do not generate an error right away, since this
+					// path might still always revert. It is only an error if this is propagated to the exit
+					// node of the function (i.e. there is a path with an uninitialized access).
+					if (_state.contains(operation.variable))
+						_state.insert(operation.access);
 					break;
 				case VariableOccurrence::Kind::Declaration:
-					unassignedVariables.insert(&variableOccurrence.declaration());
+					_state.insert(operation.variable);
 					break;
 			}
-		}
-		nodeInfo.unassignedVariablesAtExit = std::move(unassignedVariables);
+	});
 
-		// Propagate changes to all exits and queue them for traversal, if needed.
-		for (auto const& exit: currentNode->exits)
-			if (
-				auto exists = util::valueOrNullptr(nodeInfos, exit);
-				nodeInfos[exit].propagateFrom(nodeInfo) || !exists
-			)
-				nodesToTraverse.insert(exit);
-	}
+	std::vector<VariableOccurrence const*> uninitializedAccessesOrdered;
+	if (IndexSet const* exitState = dataFlow.stateAtEnd(_exit))
+		exitState->forEach([&](size_t _fact) {
+			if (_fact >= variableIndices.size())
+				uninitializedAccessesOrdered.emplace_back(accesses[_fact - variableIndices.size()]);
+		});
 
-	auto const& exitInfo = nodeInfos[_exit];
-	if (!exitInfo.uninitializedVariableAccesses.empty())
+	if (!uninitializedAccessesOrdered.empty())
 	{
-		std::vector<VariableOccurrence const*> uninitializedAccessesOrdered(
-			exitInfo.uninitializedVariableAccesses.begin(),
-			exitInfo.uninitializedVariableAccesses.end()
-		);
 		ranges::sort(
 			uninitializedAccessesOrdered,
 			[](VariableOccurrence const* lhs, VariableOccurrence const* rhs) -> bool
@@ -196,24 +189,15 @@ void ControlFlowAnalyzer::checkUninitializedAccess(CFGNode const* _entry, CFGNod
 void ControlFlowAnalyzer::checkUnreachable(CFGNode const* _entry, CFGNode const* _exit, CFGNode const* _revert, CFGNode const* _transactionReturn)
 {
 	// collect all nodes reachable from the entry point
-	std::set<CFGNode const*> reachable = util::BreadthFirstSearch<CFGNode const*>{{_entry}}.run(
-		[](CFGNode const* _node, auto&& _addChild) {
-			for (CFGNode const* exit: _node->exits)
-				_addChild(exit);
-		}
-	).visited;
+	CFGNodeOrder reachable({_entry}, CFGNodeOrder::Direction::Forward);
 
 	// traverse all paths backwards from exit, revert and transaction return
 	// and extract (valid) source locations of unreachable nodes into sorted set
+	CFGNodeOrder leadingToExit({_exit, _revert, _transactionReturn}, CFGNodeOrder::Direction::Backward);
 	std::set<SourceLocation> unreachable;
-	util::BreadthFirstSearch<CFGNode const*>{{_exit, _revert, _transactionReturn}}.run(
-		[&](CFGNode const* _node, auto&& _addChild) {
-			if (!reachable.count(_node) && _node->location.isValid())
-				unreachable.insert(_node->location);
-			for (CFGNode const* entry: _node->entries)
-				_addChild(entry);
-		}
-	);
+	for (CFGNode const* node: leadingToExit.nodes())
+		if (!reachable.index(node) && node->location.isValid())
+			unreachable.insert(node->location);
 
 	for (auto it = unreachable.begin(); it != unreachable.end();)
 	{
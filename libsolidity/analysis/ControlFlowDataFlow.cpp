@@ -0,0 +1,140 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/analysis/ControlFlowDataFlow.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <algorithm>
+#include <queue>
+#include <unordered_set>
+#include <utility>
+
+using namespace solidity;
+using namespace solidity::frontend;
+
+bool IndexSet::unite(IndexSet const& _other)
+{
+	solAssert(m_words.size() == _other.m_words.size());
+	bool changed = false;
+	for (size_t i = 0; i < m_words.size(); ++i)
+	{
+		uint64_t united = m_words[i] | _other.m_words[i];
+		changed = changed || united != m_words[i];
+		m_words[i] = united;
+	}
+	return changed;
+}
+
+void IndexSet::forEach(std::function<void(size_t)> const& _callback) const
+{
+	for (size_t i = 0; i < m_words.size(); ++i)
+		if (m_words[i])
+			for (size_t bit = 0; bit < 64; ++bit)
+				if ((m_words[i] >> bit) & 1)
+					_callback(i * 64 + bit);
+}
+
+CFGNodeOrder::CFGNodeOrder(std::vector<CFGNode const*> const& _roots, Direction _direction)
+{
+	auto adjacent = [&](CFGNode const* _node) -> std::vector<CFGNode*> const& {
+		return _direction == Direction::Forward ? _node->exits : _node->entries;
+	};
+
+	// Iterative depth-first search, recording the nodes in post-order.
+	std::unordered_set<CFGNode const*> visited;
+	std::vector<std::pair<CFGNode const*, size_t>> stack;
+	for (CFGNode const* root: _roots)
+	{
+		if (!visited.insert(root).second)
+			continue;
+		stack.emplace_back(root, 0);
+		while (!stack.empty())
+		{
+			auto& [node, nextChild] = stack.back();
+			if (nextChild < adjacent(node).size())
+			{
+				CFGNode const* child = adjacent(node)[nextChild++];
+				if (visited.insert(child).second)
+					stack.emplace_back(child, 0);
+			}
+			else
+			{
+				m_nodes.push_back(node);
+				stack.pop_back();
+			}
+		}
+	}
+	std::reverse(m_nodes.begin(), m_nodes.end());
+
+	m_indices.reserve(m_nodes.size());
+	for (size_t i = 0; i < m_nodes.size(); ++i)
+		m_indices[m_nodes[i]] = i;
+	m_successors.resize(m_nodes.size());
+	for (size_t i = 0; i < m_nodes.size(); ++i)
+		for (CFGNode const* successor: adjacent(m_nodes[i]))
+			m_successors[i].push_back(m_indices.at(successor));
+}
+
+std::optional<size_t> CFGNodeOrder::index(CFGNode const* _node) const
+{
+	if (auto it = m_indices.find(_node); it != m_indices.end())
+		return it->second;
+	return std::nullopt;
+}
+
+BitVectorDataFlow::BitVectorDataFlow(CFGNodeOrder const& _order, size_t _numFacts, Transfer _transfer):
+	m_order(_order)
+{
+	size_t numNodes = m_order.nodes().size();
+	std::vector<IndexSet> stateAtStart(numNodes, IndexSet(_numFacts));
+	m_stateAtEnd.assign(numNodes, IndexSet(_numFacts));
+
+	// Every node is processed at least once. Afterwards a node is only processed again if the
+	// state at its start has grown. Always processing the earliest node in reverse post-order
+	// means that all its predecessors outside of loops have already been processed.
+	std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>> worklist;
+	std::vector<bool> queued(numNodes, true);
+	for (size_t i = 0; i < numNodes; ++i)
+		worklist.push(i);
+
+	while (!worklist.empty())
+	{
+		size_t node = worklist.top();
+		worklist.pop();
+		queued[node] = false;
+
+		IndexSet state = stateAtStart[node];
+		_transfer(node, state);
+		m_stateAtEnd[node] = std::move(state);
+
+		for (size_t successor: m_order.successors(node))
+			if (stateAtStart[successor].unite(m_stateAtEnd[node]) && !queued[successor])
+			{
+				queued[successor] = true;
+				worklist.push(successor);
+			}
+	}
+}
+
+IndexSet const* BitVectorDataFlow::stateAtEnd(CFGNode const* _node) const
+{
+	if (std::optional<size_t> index = m_order.index(_node))
+		return &m_stateAtEnd[*index];
+	return nullptr;
+}
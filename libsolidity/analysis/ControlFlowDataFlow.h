@@ -0,0 +1,109 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Data-flow analysis framework on the control flow graph of a function, with
+ * states represented as bit vectors over densely indexed facts.
+ */
+
+#pragma once
+
+#include <libsolidity/analysis/ControlFlowGraph.h>
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/**
+ * Set of indices in the range [0, size) stored as a bit vector.
+ */
+class IndexSet
+{
+public:
+	explicit IndexSet(size_t _size = 0): m_words((_size + 63) / 64, 0) {}
+
+	bool contains(size_t _index) const { return (m_words[_index / 64] >> (_index % 64)) & 1; }
+	void insert(size_t _index) { m_words[_index / 64] |= uint64_t(1) << (_index % 64); }
+	void erase(size_t _index) { m_words[_index / 64] &= ~(uint64_t(1) << (_index % 64)); }
+
+	/// Adds all elements of @a _other, which has to have the same size.
+	/// @returns true if an element was added.
+	bool unite(IndexSet const& _other);
+
+	/// Calls @a _callback for every element in increasing order.
+	void forEach(std::function<void(size_t)> const& _callback) const;
+
+private:
+	std::vector<uint64_t> m_words;
+};
+
+/**
+ * The nodes of a control flow graph that are reachable from a set of roots, following
+ * either the exits (forward) or the entries (backward) of the nodes. The nodes are indexed
+ * densely in reverse post-order, i.e. every node precedes its successors except along back edges.
+ */
+class CFGNodeOrder
+{
+public:
+	enum class Direction { Forward, Backward };
+
+	CFGNodeOrder(std::vector<CFGNode const*> const& _roots, Direction _direction);
+
+	/// @returns the reachable nodes in reverse post-order.
+	std::vector<CFGNode const*> const& nodes() const { return m_nodes; }
+	/// @returns the indices of the successors of the node with index @a _node in the direction of the order.
+	std::vector<size_t> const& successors(size_t _node) const { return m_successors[_node]; }
+	/// @returns the index of @a _node in the order or nullopt if it is not reachable.
+	std::optional<size_t> index(CFGNode const* _node) const;
+
+private:
+	std::vector<CFGNode const*> m_nodes;
+	std::vector<std::vector<size_t>> m_successors;
+	std::unordered_map<CFGNode const*, size_t> m_indices;
+};
+
+/**
+ * Solves a data-flow problem in which the facts holding at the start of a node are the union
+ * of the facts holding at the end of its predecessors (a "may" analysis).
+ *
+ * The transfer function is given the index of a node in the order and has to turn the state at
+ * its start into the state at its end. It has to be monotone. Nodes are processed from a worklist
+ * in reverse post-order, so that the analysis converges after a number of steps proportional
+ * to the number of edges times the loop nesting depth.
+ */
+class BitVectorDataFlow
+{
+public:
+	using Transfer = std::function<void(size_t _node, IndexSet& _state)>;
+
+	/// Runs the analysis on the nodes of @a _order, starting with the empty set at the roots.
+	BitVectorDataFlow(CFGNodeOrder const& _order, size_t _numFacts, Transfer _transfer);
+
+	/// @returns the facts that may hold at the end of @a _node or nullptr if it is not reachable.
+	IndexSet const* stateAtEnd(CFGNode const* _node) const;
+
+private:
+	CFGNodeOrder const& m_order;
+	std::vector<IndexSet> m_stateAtEnd;
+};
+
+}
@@ -482,7 +482,7 @@ void OverrideChecker::checkIllegalOverrides(ContractDefinition const& _contract)
 				"Override changes function or public state variable to modifier."
 			);
 
-		checkOverrideList(OverrideProxy{modifier}, inheritedMods);
+		checkOverrideList(proxy(OverrideProxy{modifier}), inheritedMods);
 	}
 
 	for (FunctionDefinition const* function: _contract.definedFunctions())
@@ -493,7 +493,7 @@ void OverrideChecker::checkIllegalOverrides(ContractDefinition const& _contract)
 		if (contains_if(inheritedMods, MatchByName{function->name()}))
 			m_errorReporter.typeError(1469_error, function->location(), "Override changes modifier to function.");
 
-		checkOverrideList(OverrideProxy{function}, inheritedFuncs);
+		checkOverrideList(proxy(OverrideProxy{function}), inheritedFuncs);
 	}
 	for (auto const* stateVar: _contract.stateVariables())
 	{
@@ -508,7 +508,7 @@ void OverrideChecker::checkIllegalOverrides(ContractDefinition const& _contract)
 		if (contains_if(inheritedMods, MatchByName{stateVar->name()}))
 			m_errorReporter.typeError(1456_error, stateVar->location(), "Override changes modifier to public state variable.");
 
-		checkOverrideList(OverrideProxy{stateVar}, inheritedFuncs);
+		checkOverrideList(proxy(OverrideProxy{stateVar}), inheritedFuncs);
 	}
 
 }
@@ -933,10 +933,10 @@ OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheri
 			std::set<OverrideProxy, OverrideProxy::CompareBySignature> functionsInBase;
 			for (FunctionDefinition const* fun: base->definedFunctions())
 				if (!fun->isConstructor())
-					functionsInBase.emplace(OverrideProxy{fun});
+					functionsInBase.emplace(proxy(OverrideProxy{fun}));
 			for (VariableDeclaration const* var: base->stateVariables())
 				if (var->isPublic())
-					functionsInBase.emplace(OverrideProxy{var});
+					functionsInBase.emplace(proxy(OverrideProxy{var}));
 
 			result += functionsInBase;
 
@@ -945,7 +945,7 @@ OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheri
 					result.insert(func);
 		}
 
-		m_inheritedFunctions[&_contract] = result;
+		m_inheritedFunctions[&_contract] = std::move(result);
 	}
 
 	return m_inheritedFunctions[&_contract];
@@ -961,7 +961,7 @@ OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheri
 		{
 			std::set<OverrideProxy, OverrideProxy::CompareBySignature> modifiersInBase;
 			for (ModifierDefinition const* mod: base->functionModifiers())
-				modifiersInBase.emplace(OverrideProxy{mod});
+				modifiersInBase.emplace(proxy(OverrideProxy{mod}));
 
 			for (OverrideProxy const& mod: inheritedModifiers(*base))
 				modifiersInBase.insert(mod);
@@ -969,8 +969,17 @@ OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheri
 			result += modifiersInBase;
 		}
 
-		m_inheritedModifiers[&_contract] = result;
+		m_inheritedModifiers[&_contract] = std::move(result);
 	}
 
 	return m_inheritedModifiers[&_contract];
 }
+
+OverrideProxy const& OverrideChecker::proxy(OverrideProxy const& _item) const
+{
+	auto [it, inserted] = m_proxies.try_emplace(_item.declaration(), _item);
+	if (inserted)
+		// Copies made from now on share the comparator instead of recomputing it.
+		it->second.overrideComparator();
+	return it->second;
+}
@@ -156,6 +156,10 @@ public:
 	OverrideProxyBySignatureMultiSet const& inheritedFunctions(ContractDefinition const& _contract) const;
 	OverrideProxyBySignatureMultiSet const& inheritedModifiers(ContractDefinition const& _contract) const;
 
+	/// @returns a proxy for the declaration wrapped by @a _item that is shared between all
+	/// contracts inheriting it. Its override comparator is computed only once.
+	OverrideProxy const& proxy(OverrideProxy const& _item) const;
+
 private:
 	void checkIllegalOverrides(ContractDefinition const& _contract);
 	/// Performs various checks related to @a _overriding overriding @a _super like
@@ -191,6 +195,8 @@ private:
 	/// Cache for inheritedFunctions().
 	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedFunctions;
 	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedModifiers;
+	/// Cache for proxy().
+	std::map<Declaration const*, OverrideProxy> mutable m_proxies;
 };
 
 }
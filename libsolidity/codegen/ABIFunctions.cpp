@@ -85,21 +85,37 @@ std::string ABIFunctions::tupleEncoder(
 			solAssert(_targetTypes[i], "");
 			size_t sizeOnStack = _givenTypes[i]->sizeOnStack();
 			bool dynamic = _targetTypes[i]->isDynamicallyEncoded();
-			Whiskers elementTempl(
+			std::string values = suffixedVariableNameList("value", stackPos, stackPos + sizeOnStack);
+			// Value types are stored directly instead of calling a function per element,
+			// so that tuples of value types are encoded by straight-line code.
+			std::optional<std::string> encodedValue =
 				dynamic ?
-				std::string(R"(
-					mstore(add(headStart, <pos>), sub(tail, headStart))
-					tail := <abiEncode>(<values> tail)
-				)") :
-				std::string(R"(
-					<abiEncode>(<values> add(headStart, <pos>))
+				std::nullopt :
+				valueTypeEncodingExpression(*_givenTypes[i], *_targetTypes[i], options, values);
+			if (encodedValue)
+				encodeElements += Whiskers(R"(
+					mstore(add(headStart, <pos>), <encodedValue>)
 				)")
-			);
-			std::string values = suffixedVariableNameList("value", stackPos, stackPos + sizeOnStack);
-			elementTempl("values", values.empty() ? "" : values + ", ");
-			elementTempl("pos", std::to_string(headPos));
-			elementTempl("abiEncode", abiEncodingFunction(*_givenTypes[i], *_targetTypes[i], options));
-			encodeElements += elementTempl.render();
+				("pos", std::to_string(headPos))
+				("encodedValue", *encodedValue)
+				.render();
+			else
+			{
+				Whiskers elementTempl(
+					dynamic ?
+					std::string(R"(
+						mstore(add(headStart, <pos>), sub(tail, headStart))
+						tail := <abiEncode>(<values> tail)
+					)") :
+					std::string(R"(
+						<abiEncode>(<values> add(headStart, <pos>))
+					)")
+				);
+				elementTempl("values", values.empty() ? "" : values + ", ");
+				elementTempl("pos", std::to_string(headPos));
+				elementTempl("abiEncode", abiEncodingFunction(*_givenTypes[i], *_targetTypes[i], options));
+				encodeElements += elementTempl.render();
+			}
 			headPos += _targetTypes[i]->calldataHeadSize();
 			stackPos += sizeOnStack;
 		}
@@ -214,6 +230,22 @@ std::string ABIFunctions::tupleDecoder(TypePointers const& _types, bool _fromMem
 
 		std::string decodeElements;
 		std::vector<std::string> valueReturnParams;
+		// Value types are loaded directly and the validation of consecutive ones is combined
+		// into a single condition, so that there is only one branch for all of them.
+		// All validations revert without data, so combining them does not change the behaviour
+		// as long as they are checked before the next element that is decoded by a function.
+		std::vector<std::string> pendingValidations;
+		auto validatePendingValues = [&]() {
+			if (pendingValidations.empty())
+				return;
+			std::string invalid = pendingValidations.front();
+			for (size_t j = 1; j < pendingValidations.size(); ++j)
+				invalid = "or(" + invalid + ", " + pendingValidations[j] + ")";
+			decodeElements += Whiskers(R"(
+				if <invalid> { revert(0, 0) }
+			)")("invalid", invalid).render();
+			pendingValidations.clear();
+		};
 		size_t headPos = 0;
 		size_t stackPos = 0;
 		for (size_t i = 0; i < _types.size(); ++i)
@@ -230,6 +262,21 @@ std::string ABIFunctions::tupleDecoder(TypePointers const& _types, bool _fromMem
 				valueReturnParams.emplace_back("value" + std::to_string(stackPos));
 				stackPos++;
 			}
+			if (std::optional<std::string> invalid = invalidValueCondition(*_types[i], valueNamesLocal.front()))
+			{
+				decodeElements += Whiskers(R"(
+					<value> := <load>(add(headStart, <pos>))
+				)")
+				("value", valueNamesLocal.front())
+				("load", _fromMemory ? "mload" : "calldataload")
+				("pos", std::to_string(headPos))
+				.render();
+				if (!invalid->empty())
+					pendingValidations.emplace_back(std::move(*invalid));
+				headPos += decodingTypes[i]->calldataHeadSize();
+				continue;
+			}
+			validatePendingValues();
 			Whiskers elementTempl(R"(
 				{
 					<?dynamic>
@@ -251,6 +298,7 @@ std::string ABIFunctions::tupleDecoder(TypePointers const& _types, bool _fromMem
 			decodeElements += elementTempl.render();
 			headPos += decodingTypes[i]->calldataHeadSize();
 		}
+		validatePendingValues();
 		templ("valueReturnParams", boost::algorithm::join(valueReturnParams, ", "));
 		templ("arrow", valueReturnParams.empty() ? "" : "->");
 		templ("decodeElements", decodeElements);
@@ -259,6 +307,61 @@ std::string ABIFunctions::tupleDecoder(TypePointers const& _types, bool _fromMem
 	});
 }
 
+bool ABIFunctions::decodableFromReturndata(TypePointers const& _types)
+{
+	if (_types.empty())
+		return false;
+	for (auto const& t: _types)
+		if (!invalidValueCondition(*t, "value"))
+			return false;
+	return true;
+}
+
+std::string ABIFunctions::tupleDecoderFromReturndata(TypePointers const& _types)
+{
+	solAssert(decodableFromReturndata(_types));
+	std::string functionName = std::string("abi_decode_tuple_");
+	for (auto const& t: _types)
+		functionName += t->identifier();
+	functionName += "_fromReturndata";
+
+	return createFunction(functionName, [&]() {
+		Whiskers templ(R"(
+			function <functionName>() -> <valueReturnParams> {
+				if lt(returndatasize(), <size>) { <revertString>() }
+				<#values>
+					returndatacopy(0, <pos>, 32)
+					<value> := mload(0)
+				</values>
+				<?+invalid>
+					if <invalid> { revert(0, 0) }
+				</+invalid>
+			}
+		)");
+		templ("functionName", functionName);
+		templ("revertString", revertReasonIfDebugFunction("ABI decoding: tuple data too short"));
+		templ("size", std::to_string(_types.size() * 32));
+
+		std::vector<std::map<std::string, std::string>> values;
+		std::vector<std::string> valueReturnParams;
+		std::string invalid;
+		for (size_t i = 0; i < _types.size(); ++i)
+		{
+			std::string value = "value" + std::to_string(i);
+			values.push_back({{"value", value}, {"pos", std::to_string(i * 32)}});
+			valueReturnParams.emplace_back(value);
+			std::string condition = *invalidValueCondition(*_types[i], value);
+			if (condition.empty())
+				continue;
+			invalid = invalid.empty() ? condition : "or(" + invalid + ", " + condition + ")";
+		}
+		templ("values", values);
+		templ("valueReturnParams", boost::algorithm::join(valueReturnParams, ", "));
+		templ("invalid", invalid);
+		return templ.render();
+	});
+}
+
 std::string ABIFunctions::EncodingOptions::toFunctionNameSuffix() const
 {
 	std::string suffix;
@@ -374,20 +477,51 @@ std::string ABIFunctions::abiEncodingFunction(
 			templ("cleanupConvert", "value");
 		}
 		else
-		{
-			std::string cleanupConvert;
-			if (_from == to)
-				cleanupConvert = m_utils.cleanupFunction(_from) + "(value)";
-			else
-				cleanupConvert = m_utils.conversionFunction(_from, to) + "(value)";
-			if (!_options.padded)
-				cleanupConvert = m_utils.leftAlignFunction(to) + "(" + cleanupConvert + ")";
-			templ("cleanupConvert", cleanupConvert);
-		}
+			templ("cleanupConvert", cleanupConvert(_from, to, _options, "value"));
 		return templ.render();
 	});
 }
 
+std::string ABIFunctions::cleanupConvert(
+	Type const& _from,
+	Type const& _to,
+	EncodingOptions const& _options,
+	std::string const& _value
+)
+{
+	std::string cleanupConvert;
+	if (_from == _to)
+		cleanupConvert = m_utils.cleanupFunction(_from) + "(" + _value + ")";
+	else
+		cleanupConvert = m_utils.conversionFunction(_from, _to) + "(" + _value + ")";
+	if (!_options.padded)
+		cleanupConvert = m_utils.leftAlignFunction(_to) + "(" + cleanupConvert + ")";
+	return cleanupConvert;
+}
+
+std::optional<std::string> ABIFunctions::valueTypeEncodingExpression(
+	Type const& _from,
+	Type const& _to,
+	EncodingOptions const& _options,
+	std::string const& _value
+)
+{
+	// Has to match the cases of abiEncodingFunction that end up in its last branch.
+	Type const* to = _to.fullEncodingType(_options.encodeAsLibraryTypes, true, false);
+	if (
+		!to ||
+		!to->isValueType() ||
+		to->isDynamicallyEncoded() ||
+		to->calldataEncodedSize() != 32 ||
+		_from.category() == Type::Category::StringLiteral ||
+		_from.category() == Type::Category::Function ||
+		_from.sizeOnStack() != 1 ||
+		_from.dataStoredIn(DataLocation::Storage)
+	)
+		return std::nullopt;
+	return cleanupConvert(_from, *to, _options, _value);
+}
+
 std::string ABIFunctions::abiEncodeAndReturnUpdatedPosFunction(
 	Type const& _givenType,
 	Type const& _targetType,
@@ -1133,6 +1267,49 @@ std::string ABIFunctions::abiDecodingFunctionValueType(Type const& _type, bool _
 
 }
 
+std::optional<std::string> ABIFunctions::invalidValueCondition(Type const& _type, std::string const& _value)
+{
+	Type const* type = &_type;
+	if (auto userDefinedValueType = dynamic_cast<UserDefinedValueType const*>(type))
+		type = &userDefinedValueType->underlyingType();
+
+	// Has to be non-zero exactly if the validator function returned by
+	// YulUtilFunctions::validatorFunction reverts.
+	switch (type->category())
+	{
+	case Type::Category::Address:
+	case Type::Category::Contract:
+		return "gt(" + _value + ", " + toCompactHexWithPrefix((u256(1) << 160) - 1) + ")";
+	case Type::Category::Integer:
+	{
+		IntegerType const& integerType = dynamic_cast<IntegerType const&>(*type);
+		if (integerType.numBits() == 256)
+			return "";
+		else if (integerType.isSigned())
+			return "xor(" + _value + ", signextend(" + std::to_string(integerType.numBits() / 8 - 1) + ", " + _value + "))";
+		else
+			return "gt(" + _value + ", " + toCompactHexWithPrefix((u256(1) << integerType.numBits()) - 1) + ")";
+	}
+	case Type::Category::Bool:
+		return "gt(" + _value + ", 1)";
+	case Type::Category::FixedBytes:
+	{
+		FixedBytesType const& fixedBytesType = dynamic_cast<FixedBytesType const&>(*type);
+		if (fixedBytesType.numBytes() == 32)
+			return "";
+		return "and(" + _value + ", " + toCompactHexWithPrefix((u256(1) << (256 - 8 * fixedBytesType.numBytes())) - 1) + ")";
+	}
+	case Type::Category::Enum:
+	{
+		size_t members = dynamic_cast<EnumType const&>(*type).numberOfMembers();
+		solAssert(members > 0, "empty enum should have caused a parser error.");
+		return "gt(" + _value + ", " + std::to_string(members - 1) + ")";
+	}
+	default:
+		return std::nullopt;
+	}
+}
+
 std::string ABIFunctions::abiDecodingFunctionArray(ArrayType const& _type, bool _fromMemory)
 {
 	solAssert(_type.dataStoredIn(DataLocation::Memory), "");
@@ -32,6 +32,7 @@
 
 #include <functional>
 #include <map>
+#include <optional>
 #include <vector>
 
 namespace solidity::frontend
@@ -125,6 +126,18 @@ public:
 	/// stack slot, it takes exactly that number of values.
 	std::string tupleDecoder(TypePointers const& _types, bool _fromMemory = false);
 
+	/// @returns true if @a _types is non-empty and consists of value types that are each
+	/// decoded from a single word, so that tupleDecoderFromReturndata can be used for them.
+	bool decodableFromReturndata(TypePointers const& _types);
+
+	/// @returns name of an assembly function to ABI-decode values of @a _types directly
+	/// from the return data of the last call, without copying it to memory first.
+	/// Only uses scratch space and does not allocate memory.
+	/// Requires decodableFromReturndata(_types).
+	/// Inputs: none
+	/// Outputs: <value0> <value1> ... <valuen>
+	std::string tupleDecoderFromReturndata(TypePointers const& _types);
+
 	struct EncodingOptions
 	{
 		/// Pad/signextend value types and bytes/string to multiples of 32 bytes.
@@ -225,6 +238,24 @@ private:
 		EncodingOptions const& _options
 	);
 
+	/// @returns an expression that cleans up @a _value of value type @a _from and converts it
+	/// to @a _to, left-aligned if the encoding is not padded.
+	std::string cleanupConvert(
+		Type const& _from,
+		Type const& _to,
+		EncodingOptions const& _options,
+		std::string const& _value
+	);
+	/// @returns an expression that cleans up @a _value of value type @a _from and converts it to
+	/// the single word that encodes it as @a _to, or nullopt if encoding @a _from requires
+	/// more than storing such a word, i.e. if it needs the function returned by @a abiEncodingFunction.
+	std::optional<std::string> valueTypeEncodingExpression(
+		Type const& _from,
+		Type const& _to,
+		EncodingOptions const& _options,
+		std::string const& _value
+	);
+
 	/// @returns the name of the ABI decoding function for the given type
 	/// and queues the generation of the function to the requested functions.
 	/// The caller has to ensure that no out of bounds access (at least to the static
@@ -239,6 +270,10 @@ private:
 
 	/// Part of @a abiDecodingFunction for value types.
 	std::string abiDecodingFunctionValueType(Type const& _type, bool _fromMemory);
+	/// @returns a Yul expression that is non-zero if and only if the decoded @a _value is
+	/// rejected by the validator of @a _type, an empty string if every value is valid, or
+	/// nullopt if @a _type is not decoded as a single value type.
+	std::optional<std::string> invalidValueCondition(Type const& _type, std::string const& _value);
 	/// Part of @a abiDecodingFunction for "regular" array types.
 	std::string abiDecodingFunctionArray(ArrayType const& _type, bool _fromMemory);
 	/// Part of @a abiDecodingFunction for calldata array types.
@@ -57,9 +57,9 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 	bool sourceIsStorage = _sourceType.location() == DataLocation::Storage;
 	bool fromCalldata = _sourceType.location() == DataLocation::CallData;
 	bool directCopy = sourceIsStorage && sourceBaseType->isValueType() && *sourceBaseType == *targetBaseType;
-	bool haveByteOffsetSource = !directCopy && sourceIsStorage && sourceBaseType->storageBytes() <= 16;
-	bool haveByteOffsetTarget = !directCopy && targetBaseType->storageBytes() <= 16;
-	unsigned byteOffsetSize = (haveByteOffsetSource ? 1u : 0u) + (haveByteOffsetTarget ? 1u : 0u);
+	// Packed arrays are copied by the Yul utility function, which assembles
+	// each target slot on the stack and stores it with a single SSTORE.
+	bool packedTarget = !directCopy && targetBaseType->storageBytes() <= 16;
 
 	// stack: source_ref [source_length] target_ref
 	// store target_ref
@@ -67,8 +67,11 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 		m_context << swapInstruction(i);
 	// stack: target_ref source_ref [source_length]
 
-	if (_targetType.isByteArrayOrString())
+	if (_targetType.isByteArrayOrString() || packedTarget)
 	{
+		std::string copyFunction = _targetType.isByteArrayOrString() ?
+			m_context.utilFunctions().copyByteArrayToStorageFunction(_sourceType, _targetType) :
+			m_context.utilFunctions().copyValueArrayToStorageFunction(_sourceType, _targetType, true);
 		// stack: target_ref source_ref [source_length]
 		if (fromCalldata && _sourceType.isDynamicallySized())
 		{
@@ -78,7 +81,7 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 			m_context << Instruction::DUP3;
 			// stack: target_ref source_length source_ref target_ref
 			m_context.callYulFunction(
-				m_context.utilFunctions().copyByteArrayToStorageFunction(_sourceType, _targetType),
+				copyFunction,
 				3,
 				0
 			);
@@ -89,7 +92,7 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 			m_context << Instruction::DUP2;
 			// stack: target_ref source_ref target_ref
 			m_context.callYulFunction(
-				m_context.utilFunctions().copyByteArrayToStorageFunction(_sourceType, _targetType),
+				copyFunction,
 				2,
 				0
 			);
@@ -154,11 +157,11 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 			_context << Instruction::SWAP3;
 			// stack: target_ref target_data_end source_length target_data_pos source_ref
 
-			evmasm::AssemblyItem copyLoopEndWithoutByteOffset = _context.newTag();
+			evmasm::AssemblyItem skipCopyLoop = _context.newTag();
 			solAssert(!_targetType.isByteArrayOrString());
 			// skip copying if source length is zero
 			_context << Instruction::DUP3 << Instruction::ISZERO;
-			_context.appendConditionalJumpTo(copyLoopEndWithoutByteOffset);
+			_context.appendConditionalJumpTo(skipCopyLoop);
 
 			if (_sourceType.location() == DataLocation::Storage && _sourceType.isDynamicallySized())
 				CompilerUtils(_context).computeHashStatic();
@@ -167,23 +170,17 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 			utils.convertLengthToSize(_sourceType);
 			_context << Instruction::DUP3 << Instruction::ADD;
 			// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end
-			if (haveByteOffsetTarget)
-				_context << u256(0);
-			if (haveByteOffsetSource)
-				_context << u256(0);
-			// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset]
 			evmasm::AssemblyItem copyLoopStart = _context.newTag();
 			_context << copyLoopStart;
 			// check for loop condition
 			_context
-				<< dupInstruction(3 + byteOffsetSize) << dupInstruction(2 + byteOffsetSize)
+				<< Instruction::DUP3 << Instruction::DUP2
 				<< Instruction::GT << Instruction::ISZERO;
 			evmasm::AssemblyItem copyLoopEnd = _context.appendConditionalJump();
-			// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset]
+			// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end
 			// copy
 			if (sourceBaseType->category() == Type::Category::Array)
 			{
-				solAssert(byteOffsetSize == 0, "Byte offset for array as base type.");
 				auto const& sourceBaseArrayType = dynamic_cast<ArrayType const&>(*sourceBaseType);
 
 				solUnimplementedAssert(
@@ -201,7 +198,6 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 			}
 			else if (directCopy)
 			{
-				solAssert(byteOffsetSize == 0, "Byte offset for direct copy.");
 				_context
 					<< Instruction::DUP3 << Instruction::SLOAD
 					<< Instruction::DUP3 << Instruction::SSTORE;
@@ -209,81 +205,49 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 			else
 			{
 				// Note that we have to copy each element on its own in case conversion is involved.
-				// We might copy too much if there is padding at the last element, but this way end
-				// checking is easier.
-				// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset]
-				_context << dupInstruction(3 + byteOffsetSize);
+				// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end
+				_context << Instruction::DUP3;
 				if (_sourceType.location() == DataLocation::Storage)
 				{
-					if (haveByteOffsetSource)
-						_context << Instruction::DUP2;
-					else
-						_context << u256(0);
+					_context << u256(0);
 					StorageItem(_context, *sourceBaseType).retrieveValue(SourceLocation(), true);
 				}
 				else if (sourceBaseType->isValueType())
 					CompilerUtils(_context).loadFromMemoryDynamic(*sourceBaseType, fromCalldata, true, false);
 				else
 					solUnimplemented("Copying of type " + _sourceType.toString(false) + " to storage not yet supported.");
-				// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset] <source_value>...
+				// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end <source_value>...
 				assertThrow(
-					2 + byteOffsetSize + sourceBaseType->sizeOnStack() <= 16,
+					2 + sourceBaseType->sizeOnStack() <= 16,
 					StackTooDeepError,
 					util::stackTooDeepString
 				);
 				// fetch target storage reference
-				_context << dupInstruction(2 + byteOffsetSize + sourceBaseType->sizeOnStack());
-				if (haveByteOffsetTarget)
-					_context << dupInstruction(1 + byteOffsetSize + sourceBaseType->sizeOnStack());
-				else
-					_context << u256(0);
+				_context << dupInstruction(2 + sourceBaseType->sizeOnStack());
+				_context << u256(0);
 				StorageItem(_context, *targetBaseType).storeValue(*sourceBaseType, SourceLocation(), true);
 			}
-			// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset]
+			// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end
 			// increment source
-			if (haveByteOffsetSource)
-				utils.incrementByteOffset(sourceBaseType->storageBytes(), 1, haveByteOffsetTarget ? 5 : 4);
+			_context << Instruction::SWAP2;
+			if (sourceIsStorage)
+				_context << sourceBaseType->storageSize();
+			else if (_sourceType.location() == DataLocation::Memory)
+				_context << sourceBaseType->memoryHeadSize();
 			else
-			{
-				_context << swapInstruction(2 + byteOffsetSize);
-				if (sourceIsStorage)
-					_context << sourceBaseType->storageSize();
-				else if (_sourceType.location() == DataLocation::Memory)
-					_context << sourceBaseType->memoryHeadSize();
-				else
-					_context << sourceBaseType->calldataHeadSize();
-				_context
-					<< Instruction::ADD
-					<< swapInstruction(2 + byteOffsetSize);
-			}
+				_context << sourceBaseType->calldataHeadSize();
+			_context
+				<< Instruction::ADD
+				<< Instruction::SWAP2;
 			// increment target
-			if (haveByteOffsetTarget)
-				utils.incrementByteOffset(targetBaseType->storageBytes(), byteOffsetSize, byteOffsetSize + 2);
-			else
-				_context
-					<< swapInstruction(1 + byteOffsetSize)
-					<< targetBaseType->storageSize()
-					<< Instruction::ADD
-					<< swapInstruction(1 + byteOffsetSize);
+			_context
+				<< Instruction::SWAP1
+				<< targetBaseType->storageSize()
+				<< Instruction::ADD
+				<< Instruction::SWAP1;
 			_context.appendJumpTo(copyLoopStart);
 			_context << copyLoopEnd;
-			if (haveByteOffsetTarget)
-			{
-				// clear elements that might be left over in the current slot in target
-				// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end target_byte_offset [source_byte_offset]
-				_context << dupInstruction(byteOffsetSize) << Instruction::ISZERO;
-				evmasm::AssemblyItem copyCleanupLoopEnd = _context.appendConditionalJump();
-				_context << dupInstruction(2 + byteOffsetSize) << dupInstruction(1 + byteOffsetSize);
-				StorageItem(_context, *targetBaseType).setToZero(SourceLocation(), true);
-				utils.incrementByteOffset(targetBaseType->storageBytes(), byteOffsetSize, byteOffsetSize + 2);
-				_context.appendJumpTo(copyLoopEnd);
-
-				_context << copyCleanupLoopEnd;
-				_context << Instruction::POP; // might pop the source, but then target is popped next
-			}
-			if (haveByteOffsetSource)
-				_context << Instruction::POP;
-			_context << copyLoopEndWithoutByteOffset;
+			_context << skipCopyLoop;
 
 			// zero-out leftovers in target
 			// stack: target_ref target_data_end source_data_pos target_data_pos_updated source_data_end
@@ -93,6 +93,11 @@ void CompilerUtils::toSizeAfterFreeMemoryPointer()
 void CompilerUtils::revertWithStringData(Type const& _argumentType)
 {
 	solAssert(_argumentType.isImplicitlyConvertibleTo(*TypeProvider::fromElementaryTypeName("string memory")));
+	if (auto data = constantErrorData("Error(string)", {TypeProvider::stringMemory()}, {&_argumentType}))
+	{
+		revertWithConstantData(*data);
+		return;
+	}
 	fetchFreeMemoryPointer();
 	m_context << util::selectorFromSignatureU256("Error(string)");
 	m_context << Instruction::DUP2 << Instruction::MSTORE;
@@ -109,6 +114,13 @@ void CompilerUtils::revertWithError(
 	std::vector<Type const*> const& _argumentTypes
 )
 {
+	if (auto data = constantErrorData(_signature, _parameterTypes, _argumentTypes))
+	{
+		for (size_t i = _argumentTypes.size(); i > 0; --i)
+			popStackElement(*_argumentTypes[i - 1]);
+		revertWithConstantData(*data);
+		return;
+	}
 	fetchFreeMemoryPointer();
 	m_context << util::selectorFromSignatureU256(_signature);
 	m_context << Instruction::DUP2 << Instruction::MSTORE;
@@ -119,6 +131,64 @@ void CompilerUtils::revertWithError(
 	m_context << Instruction::REVERT;
 }
 
+void CompilerUtils::revertWithConstantData(bytes const& _data)
+{
+	fetchFreeMemoryPointer();
+	m_context << u256(_data.size()) << Instruction::DUP1;
+	m_context.appendData(_data);
+	// Stack: <mem pos> <size> <size> <data offset>
+	m_context << Instruction::DUP4 << Instruction::CODECOPY;
+	m_context << Instruction::SWAP1 << Instruction::REVERT;
+}
+
+std::optional<bytes> CompilerUtils::constantErrorData(
+	std::string const& _signature,
+	std::vector<Type const*> const& _parameterTypes,
+	std::vector<Type const*> const& _argumentTypes
+)
+{
+	solAssert(_parameterTypes.size() == _argumentTypes.size());
+	bytes head = util::selectorFromSignatureH32(_signature).asBytes();
+	bytes tail;
+	size_t const headSize = 32 * _parameterTypes.size();
+	for (size_t i = 0; i < _parameterTypes.size(); ++i)
+	{
+		Type const* parameterType = _parameterTypes[i];
+		if (auto const* literal = dynamic_cast<StringLiteralType const*>(_argumentTypes[i]))
+		{
+			bytes value = util::asBytes(literal->value());
+			auto const* arrayType = dynamic_cast<ArrayType const*>(parameterType);
+			if (auto const* fixedBytesType = dynamic_cast<FixedBytesType const*>(parameterType))
+			{
+				solAssert(value.size() <= fixedBytesType->numBytes());
+				head += h256(value, h256::AlignLeft).asBytes();
+			}
+			else if (arrayType && arrayType->isByteArrayOrString())
+			{
+				head += toBigEndian(u256(headSize + tail.size()));
+				tail += toBigEndian(u256(value.size()));
+				value.resize((value.size() + 31) / 32 * 32);
+				tail += value;
+			}
+			else
+				return std::nullopt;
+		}
+		else if (
+			auto const* number = dynamic_cast<RationalNumberType const*>(_argumentTypes[i]);
+			number && !number->isFractional() && dynamic_cast<IntegerType const*>(parameterType)
+		)
+			head += toBigEndian(number->literalValue(nullptr));
+		else
+			return std::nullopt;
+	}
+
+	// Storing a word costs about as much as copying it, but the copy needs a few more
+	// instructions and stores the selector and zero padding in the code as well.
+	if (head.size() + tail.size() <= 4 + 3 * 32)
+		return std::nullopt;
+	return head + tail;
+}
+
 void CompilerUtils::returnDataToArray()
 {
 	if (m_context.evmVersion().supportsReturndata())
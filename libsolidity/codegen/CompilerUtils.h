@@ -29,6 +29,8 @@
 #include <libsolidity/codegen/CompilerContext.h>
 #include <libsolidity/codegen/CompilerContext.h>
 
+#include <optional>
+
 namespace solidity::frontend
 {
 
@@ -76,6 +78,21 @@ public:
 		std::vector<Type const*> const& _argumentTypes
 	);
 
+	/// Appends code that copies @a _data from the data section of the code to free memory
+	/// and reverts with it. Identical data is stored only once in the code.
+	/// Stack pre:
+	/// Stack post:
+	void revertWithConstantData(bytes const& _data);
+
+	/// @returns the data of the error with signature @a _signature if all arguments are
+	/// compile-time constants and the data is large enough that copying it from the data section
+	/// is cheaper than storing it in memory word by word, and nullopt otherwise.
+	static std::optional<bytes> constantErrorData(
+		std::string const& _signature,
+		std::vector<Type const*> const& _parameterTypes,
+		std::vector<Type const*> const& _argumentTypes
+	);
+
 	/// Allocates a new array and copies the return data to it.
 	/// If the EVM does not support return data, creates an empty array.
 	void returnDataToArray();
@@ -87,6 +87,37 @@ private:
 	unsigned stackHeight;
 };
 
+/**
+ * Counts the placeholder and return statements in the body of a modifier and all its nodes,
+ * the latter as a rough estimate of the size of its code.
+ */
+class ModifierBodyInspector: private ASTConstVisitor
+{
+public:
+	explicit ModifierBodyInspector(Block const& _body) { _body.accept(*this); }
+
+	size_t placeholders = 0;
+	size_t returns = 0;
+	size_t nodes = 0;
+
+private:
+	bool visitNode(ASTNode const&) override
+	{
+		++nodes;
+		return true;
+	}
+	bool visit(PlaceholderStatement const& _placeholder) override
+	{
+		++placeholders;
+		return visitNode(_placeholder);
+	}
+	bool visit(Return const& _return) override
+	{
+		++returns;
+		return visitNode(_return);
+	}
+};
+
 }
 
 void ContractCompiler::compileContract(
@@ -1416,12 +1447,23 @@ void ContractCompiler::endVisit(Block const& _block)
 
 void ContractCompiler::appendMissingFunctions()
 {
-	while (Declaration const* function = m_context.nextFunctionToCompile())
+	do
 	{
-		m_context.setStackOffset(0);
-		function->accept(*this);
-		solAssert(m_context.nextFunctionToCompile() != function, "Compiled the wrong function?");
+		while (Declaration const* function = m_context.nextFunctionToCompile())
+		{
+			m_context.setStackOffset(0);
+			function->accept(*this);
+			solAssert(m_context.nextFunctionToCompile() != function, "Compiled the wrong function?");
+		}
+		// Shared modifier code can reference further functions, but not the other way around.
+		while (!m_sharedModifierCodeQueue.empty())
+		{
+			auto [modifier, epilogue] = m_sharedModifierCodeQueue.front();
+			m_sharedModifierCodeQueue.pop();
+			appendSharedModifierCode(*modifier, epilogue);
+		}
 	}
+	while (m_context.nextFunctionToCompile());
 	m_context.appendMissingLowLevelFunctions();
 	m_context.appendYulUtilityFunctions(m_optimiserSettings);
 }
@@ -1431,6 +1473,8 @@ void ContractCompiler::appendModifierOrFunctionCode()
 	solAssert(m_currentFunction, "");
 	unsigned stackSurplus = 0;
 	Block const* codeBlock = nullptr;
+	ModifierDefinition const* sharedModifier = nullptr;
+	std::optional<size_t> sharedPlaceholder;
 	std::vector<VariableDeclaration const*> addedVariables;
 
 	m_modifierDepth++;
@@ -1477,6 +1521,9 @@ void ContractCompiler::appendModifierOrFunctionCode()
 
 			stackSurplus = CompilerUtils::sizeOnStack(modifier.parameters());
 			codeBlock = &modifier.body();
+			sharedPlaceholder = sharedModifierPlaceholder(modifier);
+			if (sharedPlaceholder)
+				sharedModifier = &modifier;
 		}
 	}
 
@@ -1488,7 +1535,17 @@ void ContractCompiler::appendModifierOrFunctionCode()
 		m_context.setUseABICoderV2(*codeBlock->sourceUnit().annotation().useABICoderV2);
 
 		m_returnTags.emplace_back(m_context.newTag(), m_context.stackHeight());
-		codeBlock->accept(*this);
+		if (sharedModifier)
+		{
+			std::vector<ASTPointer<Statement>> const& statements = codeBlock->statements();
+			if (*sharedPlaceholder > 0)
+				appendSharedModifierCall(*sharedModifier, false);
+			statements.at(*sharedPlaceholder)->accept(*this);
+			if (*sharedPlaceholder + 1 < statements.size())
+				appendSharedModifierCall(*sharedModifier, true);
+		}
+		else
+			codeBlock->accept(*this);
 
 		m_context.setUseABICoderV2(coderV2Outside);
 
@@ -1504,6 +1561,129 @@ void ContractCompiler::appendModifierOrFunctionCode()
 	m_context.setModifierDepth(m_modifierDepth);
 }
 
+std::optional<size_t> ContractCompiler::sharedModifierPlaceholder(ModifierDefinition const& _modifier)
+{
+	if (!m_optimiserSettings.shareModifierCode)
+		return std::nullopt;
+	if (auto cached = m_sharedModifierPlaceholders.find(&_modifier); cached != m_sharedModifierPlaceholders.end())
+		return cached->second;
+	std::optional<size_t>& result = m_sharedModifierPlaceholders[&_modifier];
+
+	ContractDefinition const& contract = m_context.mostDerivedContract();
+	if (m_modifierInvocationCounts.empty())
+		for (ContractDefinition const* base: contract.annotation().linearizedBaseContracts)
+			for (FunctionDefinition const* function: base->definedFunctions())
+				for (ASTPointer<ModifierInvocation> const& invocation: function->modifiers())
+					if (auto modifier = dynamic_cast<ModifierDefinition const*>(invocation->name().annotation().referencedDeclaration))
+						++m_modifierInvocationCounts[
+							*invocation->name().annotation().requiredLookup == VirtualLookup::Virtual ?
+							&modifier->resolveVirtual(contract) :
+							modifier
+						];
+	auto invocationCount = m_modifierInvocationCounts.find(&_modifier);
+	if (invocationCount == m_modifierInvocationCounts.end() || invocationCount->second < 2)
+		return result;
+	size_t const invocations = invocationCount->second;
+
+	// The code before the placeholder must not leave variables on the stack and no part of the
+	// modifier must depend on the function it is applied to, which is the case for return
+	// statements and further placeholders.
+	ModifierBodyInspector body{_modifier.body()};
+	if (body.placeholders != 1 || body.returns != 0)
+		return result;
+	std::vector<ASTPointer<Statement>> const& statements = _modifier.body().statements();
+	size_t placeholder = 0;
+	for (; placeholder < statements.size(); ++placeholder)
+		if (dynamic_cast<PlaceholderStatement const*>(statements[placeholder].get()))
+			break;
+		else if (dynamic_cast<VariableDeclarationStatement const*>(statements[placeholder].get()))
+			return result;
+	if (placeholder == statements.size())
+		return result;
+
+	size_t const parts = (placeholder > 0 ? 1u : 0u) + (placeholder + 1 < statements.size() ? 1u : 0u);
+	if (parts == 0)
+		return result;
+
+	// Compare the costs of depositing one copy of the code per invocation with the costs of
+	// depositing the code once plus the calls, and executing the calls on every run.
+	bool const isCreation = m_runtimeCompiler != nullptr;
+	size_t const runs = isCreation ? 1 : m_optimiserSettings.expectedExecutionsPerDeployment;
+	EVMVersion const evmVersion = m_context.evmVersion();
+	// Rough estimate of the size of the code, not counting the body block and the placeholder.
+	uint64_t const codeSize = (body.nodes - 2) * 5;
+	// Call site: PUSH <return tag> PUSH <entry tag> JUMP <return tag>, subroutine: <entry tag> ... JUMP
+	uint64_t const callSize = 3 + 3 + 1 + 1;
+	uint64_t const subroutineSize = 1 + 1;
+	bigint const callGas =
+		2 * GasMeter::runGas(Instruction::PUSH2, evmVersion) +
+		2 * GasMeter::runGas(Instruction::JUMP, evmVersion) +
+		2 * GasMeter::runGas(Instruction::JUMPDEST, evmVersion);
+	bigint const inlinedCost = GasMeter::dataGas(invocations * codeSize, isCreation, evmVersion);
+	bigint const sharedCost =
+		GasMeter::dataGas(codeSize + parts * (subroutineSize + invocations * callSize), isCreation, evmVersion) +
+		bigint(runs) * invocations * parts * callGas;
+	if (sharedCost < inlinedCost)
+		result = placeholder;
+	return result;
+}
+
+void ContractCompiler::appendSharedModifierCall(ModifierDefinition const& _modifier, bool _epilogue)
+{
+	auto [entry, inserted] = m_sharedModifierCode.try_emplace({&_modifier, _epilogue}, m_context.newTag());
+	if (inserted)
+		m_sharedModifierCodeQueue.emplace(&_modifier, _epilogue);
+
+	evmasm::AssemblyItem returnTag = m_context.pushNewTag();
+	m_context.appendJumpTo(entry->second, evmasm::AssemblyItem::JumpType::IntoFunction);
+	m_context.adjustStackOffset(-1);
+	m_context << returnTag.tag();
+}
+
+void ContractCompiler::appendSharedModifierCode(ModifierDefinition const& _modifier, bool _epilogue)
+{
+	CompilerContext::LocationSetter locationSetter(m_context, _modifier);
+
+	// stack upon entry: [param0] ... [paramn] [return address]
+	unsigned const parametersSize = CompilerUtils::sizeOnStack(_modifier.parameters());
+	m_context.setStackOffset(static_cast<int>(parametersSize) + 1);
+	m_context << m_sharedModifierCode.at({&_modifier, _epilogue});
+	unsigned offset = parametersSize + 1;
+	for (ASTPointer<VariableDeclaration> const& variable: _modifier.parameters())
+	{
+		m_context.addVariable(*variable, offset);
+		offset -= variable->annotation().type->sizeOnStack();
+	}
+
+	m_breakTags.clear();
+	m_continueTags.clear();
+	m_modifierDepth = 0;
+	m_scopeStackHeight.clear();
+	m_context.setModifierDepth(0);
+	m_context.setArithmetic(Arithmetic::Checked);
+	bool coderV2Outside = m_context.useABICoderV2();
+	m_context.setUseABICoderV2(*_modifier.body().sourceUnit().annotation().useABICoderV2);
+
+	Block const& body = _modifier.body();
+	m_context.pushVisitedNodes(&body);
+	storeStackHeight(&body);
+	bool afterPlaceholder = false;
+	for (ASTPointer<Statement> const& statement: body.statements())
+		if (dynamic_cast<PlaceholderStatement const*>(statement.get()))
+			afterPlaceholder = true;
+		else if (afterPlaceholder == _epilogue)
+			statement->accept(*this);
+	popScopedVariables(&body);
+	m_context.popVisitedNodes();
+
+	m_context.setUseABICoderV2(coderV2Outside);
+	for (ASTPointer<VariableDeclaration> const& variable: _modifier.parameters())
+		m_context.removeVariable(*variable);
+	solAssert(m_context.numberOfLocalVariables() == 0, "");
+	solAssert(m_context.stackHeight() == parametersSize + 1, "");
+	m_context.appendJump(evmasm::AssemblyItem::JumpType::OutOfFunction);
+}
+
 void ContractCompiler::appendStackVariableInitialisation(
 	VariableDeclaration const& _variable,
 	bool _provideDefaultValue
@@ -30,6 +30,8 @@
 #include <functional>
 #include <ostream>
 #include <map>
+#include <optional>
+#include <queue>
 
 namespace solidity::frontend
 {
@@ -131,6 +133,17 @@ private:
 	/// body itself if the last modifier was reached.
 	void appendModifierOrFunctionCode();
 
+	/// @returns the index of the placeholder statement in the body of @a _modifier if the code
+	/// before and after it is to be compiled as shared subroutines instead of being inlined
+	/// into every function the modifier is applied to, and nullopt otherwise.
+	std::optional<size_t> sharedModifierPlaceholder(ModifierDefinition const& _modifier);
+	/// Appends a call to the shared subroutine for the code of @a _modifier before (@a _epilogue
+	/// false) or after (@a _epilogue true) the placeholder. The modifier parameters have to be
+	/// on the stack and are kept there.
+	void appendSharedModifierCall(ModifierDefinition const& _modifier, bool _epilogue);
+	/// Appends the shared subroutine for the code of @a _modifier before or after the placeholder.
+	void appendSharedModifierCode(ModifierDefinition const& _modifier, bool _epilogue);
+
 	/// Creates a stack slot for the given variable and assigns a default value.
 	/// If the default value is complex (needs memory allocation) and @a _provideDefaultValue
 	/// is false, this might be skipped.
@@ -163,6 +176,16 @@ private:
 
 	/// Stores the variables that were declared inside a specific scope, for each modifier depth.
 	std::map<unsigned, std::map<ASTNode const*, unsigned>> m_scopeStackHeight;
+
+	/// Number of invocations of each modifier in the functions of the contract.
+	std::map<ModifierDefinition const*, size_t> m_modifierInvocationCounts;
+	/// Cache for sharedModifierPlaceholder.
+	std::map<ModifierDefinition const*, std::optional<size_t>> m_sharedModifierPlaceholders;
+	/// Entry tags of the shared modifier subroutines, indexed by modifier and whether it
+	/// is the code after the placeholder.
+	std::map<std::pair<ModifierDefinition const*, bool>, evmasm::AssemblyItem> m_sharedModifierCode;
+	/// Shared modifier subroutines that are called, but have not been generated yet.
+	std::queue<std::pair<ModifierDefinition const*, bool>> m_sharedModifierCodeQueue;
 };
 
 }
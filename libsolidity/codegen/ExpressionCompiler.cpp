@@ -2670,6 +2670,14 @@ void ExpressionCompiler::appendExternalFunctionCall(
 	unsigned const retSize = returnInfo.estimatedReturnSize;
 	bool const dynamicReturnSize = returnInfo.dynamicReturnSize;
 	TypePointers const& returnTypes = returnInfo.returnTypes;
+	// Static return values that are single words are decoded straight from the return data,
+	// so that no output area has to be reserved in memory.
+	bool const decodeFromReturndata =
+		(funKind == FunctionType::Kind::External || funKind == FunctionType::Kind::DelegateCall) &&
+		!dynamicReturnSize &&
+		haveReturndatacopy &&
+		m_context.useABICoderV2() &&
+		m_context.abiFunctions().decodableFromReturndata(returnTypes);
 
 	// Evaluate arguments.
 	TypePointers argumentTypes;
@@ -2699,11 +2707,10 @@ void ExpressionCompiler::appendExternalFunctionCall(
 	}
 	if (funKind == FunctionType::Kind::Caerus)
 	{
+		// The output is written to and read from scratch space, which is cleared
+		// first because a failing call cannot be detected.
 		solAssert(0 < retSize && retSize <= 32, "");
-		utils().fetchFreeMemoryPointer();
-		m_context << u256(0) << Instruction::DUP2 << Instruction::MSTORE;
-		m_context << u256(32) << Instruction::ADD;
-		utils().storeFreeMemoryPointer();
+		m_context << u256(0) << u256(0) << Instruction::MSTORE;
 	}
 
 	if (!m_context.evmVersion().canOverchargeGasForCall())
@@ -2712,7 +2719,12 @@ void ExpressionCompiler::appendExternalFunctionCall(
 		// (which we would have to subtract from the gas left)
 		// We could also just use MLOAD; POP right before the gas calculation, but the optimizer
 		// would remove that, so we use MSTORE here.
-		if (!_functionType.gasSet() && retSize > 0)
+		if (
+			!_functionType.gasSet() &&
+			retSize > 0 &&
+			!decodeFromReturndata &&
+			funKind != FunctionType::Kind::Caerus
+		)
 		{
 			m_context << u256(0);
 			utils().fetchFreeMemoryPointer();
@@ -2757,9 +2769,10 @@ void ExpressionCompiler::appendExternalFunctionCall(
 	// contract address
 
 	// Output data will replace input data, unless we have ECRecover (then, output
-	// area will be 32 bytes just before input area).
+	// area will be 32 bytes just before input area), Caerus (then, output area is the
+	// scratch space) or decode directly from the return data (then, there is no output area).
 	// put on stack: <size of output> <memory pos of output> <size of input> <memory pos of input>
-	m_context << u256(retSize);
+	m_context << u256(decodeFromReturndata ? 0 : retSize);
 	utils().fetchFreeMemoryPointer(); // This is the start of input
 	if (funKind == FunctionType::Kind::ECRecover)
 	{
@@ -2771,8 +2784,9 @@ void ExpressionCompiler::appendExternalFunctionCall(
 	}
 	else if (funKind == FunctionType::Kind::Caerus)
 	{
-		m_context << u256(32) << Instruction::DUP2 << Instruction::SUB << Instruction::SWAP1;
-		m_context << Instruction::DUP1 << Instruction::DUP4 << Instruction::SUB;
+		m_context << u256(0) << Instruction::SWAP1;
+		// Here: <input end> <output size> <outpos> <input pos>
+		m_context << Instruction::DUP1 << Instruction::DUP5 << Instruction::SUB;
 		m_context << Instruction::SWAP1;
 	}
 	else
@@ -2890,11 +2904,13 @@ void ExpressionCompiler::appendExternalFunctionCall(
 		m_context << Instruction::SUB << Instruction::MLOAD;
 	}
 	else if (funKind == FunctionType::Kind::Caerus)
-	{
-		m_context << u256(32);
-		utils().fetchFreeMemoryPointer();
-		m_context << Instruction::SUB << Instruction::MLOAD;
-	}
+		m_context << u256(0) << Instruction::MLOAD;
+	else if (decodeFromReturndata)
+		m_context.callYulFunction(
+			m_context.abiFunctions().tupleDecoderFromReturndata(returnTypes),
+			0,
+			CompilerUtils::sizeOnStack(returnTypes)
+		);
 	else if (!returnTypes.empty())
 	{
 		utils().fetchFreeMemoryPointer();
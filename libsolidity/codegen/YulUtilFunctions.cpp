@@ -2004,7 +2004,11 @@ std::string YulUtilFunctions::copyByteArrayToStorageFunction(ArrayType const& _f
 	});
 }
 
-std::string YulUtilFunctions::copyValueArrayToStorageFunction(ArrayType const& _fromType, ArrayType const& _toType)
+std::string YulUtilFunctions::copyValueArrayToStorageFunction(
+	ArrayType const& _fromType,
+	ArrayType const& _toType,
+	bool _cleanCalldata
+)
 {
 	solAssert(_fromType.baseType()->isValueType(), "");
 	solAssert(_toType.baseType()->isValueType(), "");
@@ -2017,7 +2021,13 @@ std::string YulUtilFunctions::copyValueArrayToStorageFunction(ArrayType const& _
 	solAssert(_fromType.storageStride() <= _toType.storageStride(), "");
 	solAssert(_toType.storageStride() <= 32, "");
 
-	std::string functionName = "copy_array_to_storage_from_" + _fromType.identifier() + "_to_" + _toType.identifier();
+	bool cleanCalldata = _cleanCalldata && _fromType.dataStoredIn(DataLocation::CallData);
+	std::string functionName =
+		"copy_array_to_storage_from_" +
+		_fromType.identifier() +
+		"_to_" +
+		_toType.identifier() +
+		(cleanCalldata ? "_cleaned" : "");
 	return m_functionCollector.createFunction(functionName, [&](){
 		Whiskers templ(R"(
 			function <functionName>(dst, src<?isFromDynamicCalldata>, len</isFromDynamicCalldata>) {
@@ -2052,7 +2062,11 @@ std::string YulUtilFunctions::copyValueArrayToStorageFunction(ArrayType const& _
 								<extractFromSlot>(srcSlotValue, mul(<srcStride>, srcItemIndexInSlot))
 							)
 							<!isFromStorage>
+							<?cleanCalldata>
+							let <stackItems> := <cleanup>(calldataload(srcPtr))
+							<!cleanCalldata>
 							let <stackItems> := <readFromMemoryOrCalldata>(srcPtr)
+							</cleanCalldata>
 							</isFromStorage>
 							let itemValue := <prepareStore>(<stackItems>)
 							dstSlotValue :=
@@ -2083,7 +2097,11 @@ std::string YulUtilFunctions::copyValueArrayToStorageFunction(ArrayType const& _
 									<extractFromSlot>(srcSlotValue, mul(<srcStride>, srcItemIndexInSlot))
 								)
 								<!isFromStorage>
+								<?cleanCalldata>
+								let <stackItems> := <cleanup>(calldataload(srcPtr))
+								<!cleanCalldata>
 								let <stackItems> := <readFromMemoryOrCalldata>(srcPtr)
+								</cleanCalldata>
 								</isFromStorage>
 								let itemValue := <prepareStore>(<stackItems>)
 								dstSlotValue := <updateByteSlice>(dstSlotValue, mul(<dstStride>, j), itemValue)
@@ -2107,7 +2125,16 @@ std::string YulUtilFunctions::copyValueArrayToStorageFunction(ArrayType const& _
 		templ("panic", panicFunction(PanicCode::ResourceError));
 		templ("isFromDynamicCalldata", _fromType.isDynamicallySized() && fromCalldata);
 		templ("isFromStorage", fromStorage);
-		templ("readFromMemoryOrCalldata", readFromMemoryOrCalldata(*_fromType.baseType(), fromCalldata));
+		// Dirty elements are cleaned up like in the legacy code generator instead of
+		// causing a revert.
+		templ("cleanCalldata", cleanCalldata);
+		if (cleanCalldata)
+		{
+			solAssert(_fromType.baseType()->sizeOnStack() == 1);
+			templ("cleanup", cleanupFunction(*_fromType.baseType()));
+		}
+		else
+			templ("readFromMemoryOrCalldata", readFromMemoryOrCalldata(*_fromType.baseType(), fromCalldata));
 		templ("srcDataLocation", arrayDataAreaFunction(_fromType));
 		templ("dstDataLocation", arrayDataAreaFunction(_toType));
 		templ("srcStride", std::to_string(_fromType.storageStride()));
@@ -260,8 +260,10 @@ public:
 	std::string copyByteArrayToStorageFunction(ArrayType const& _fromType, ArrayType const& _toType);
 
 	/// @returns the name of a function that will copy an array of value types to storage.
+	/// If @a _cleanCalldata is true, dirty calldata elements are cleaned up as in the
+	/// legacy code generator instead of causing a revert.
 	/// signature (to_slot, from_ptr[, from_length]) ->
-	std::string copyValueArrayToStorageFunction(ArrayType const& _fromType, ArrayType const& _toType);
+	std::string copyValueArrayToStorageFunction(ArrayType const& _fromType, ArrayType const& _toType, bool _cleanCalldata = false);
 
 	/// Returns the name of a function that will convert a given length to the
 	/// size in memory (number of storage slots or calldata/memory bytes) it
@@ -27,6 +27,7 @@
 #include <libsolidity/ast/AST.h>
 #include <libsolidity/ast/TypeProvider.h>
 
+#include <libsolutil/Keccak256.h>
 #include <libsolutil/Whiskers.h>
 #include <libsolutil/StringUtils.h>
 
@@ -70,6 +71,15 @@ IRVariable const& IRGenerationContext::addLocalVariable(VariableDeclaration cons
 	return it->second;
 }
 
+IRVariable const& IRGenerationContext::addLocalVariable(VariableDeclaration const& _varDecl, Type const& _type)
+{
+	auto const& [it, didInsert] = m_localVariables.emplace(
+		std::make_pair(&_varDecl, IRVariable{IRNames::localVariable(_varDecl), _type})
+	);
+	solAssert(didInsert, "Local variable added multiple times.");
+	return it->second;
+}
+
 IRVariable const& IRGenerationContext::localVariable(VariableDeclaration const& _varDecl)
 {
 	solAssert(
@@ -123,6 +133,13 @@ void IRGenerationContext::addStateVariable(
 	m_stateVariables[&_declaration] = std::make_pair(std::move(_storageOffset), _byteOffset);
 }
 
+std::string IRGenerationContext::registerConstantData(bytes const& _data)
+{
+	std::string name = "data_" + toHex(keccak256(_data));
+	m_constantData.emplace(name, _data);
+	return name;
+}
+
 std::string IRGenerationContext::newYulVariable()
 {
 	return "_" + std::to_string(++m_varCounter);
@@ -104,10 +104,18 @@ public:
 
 
 	IRVariable const& addLocalVariable(VariableDeclaration const& _varDecl);
+	/// Adds a local variable that is represented by a value of type @a _type instead of its declared type.
+	IRVariable const& addLocalVariable(VariableDeclaration const& _varDecl, Type const& _type);
 	bool isLocalVariable(VariableDeclaration const& _varDecl) const { return m_localVariables.count(&_varDecl); }
 	IRVariable const& localVariable(VariableDeclaration const& _varDecl);
 	void resetLocalVariables();
 
+	/// Sets the local memory struct variables of the function currently being generated that
+	/// refer to the storage struct they are initialized with instead of holding a copy of it.
+	/// @see LazyStructCopyFinder
+	void setLazyStructCopies(std::set<VariableDeclaration const*> _variables) { m_lazyStructCopies = std::move(_variables); }
+	bool isLazyStructCopy(VariableDeclaration const& _varDecl) const { return m_lazyStructCopies.count(&_varDecl); }
+
 	/// Registers an immutable variable of the contract.
 	/// Should only be called at construction time.
 	void registerImmutableVariable(VariableDeclaration const& _varDecl);
@@ -157,6 +165,12 @@ public:
 
 	std::set<ContractDefinition const*, ASTNode::CompareByID>& subObjectsCreated() { return m_subObjects; }
 
+	/// Registers @a _data to be stored as a data object inside the current Yul object
+	/// and @returns the name of that data object. Identical data is stored only once.
+	std::string registerConstantData(bytes const& _data);
+	/// @returns the data objects of the current Yul object by name.
+	std::map<std::string, bytes> const& constantData() const { return m_constantData; }
+
 	bool memoryUnsafeInlineAssemblySeen() const { return m_memoryUnsafeInlineAssemblySeen; }
 	void setMemoryUnsafeInlineAssemblySeen() { m_memoryUnsafeInlineAssemblySeen = true; }
 
@@ -177,6 +191,7 @@ private:
 	std::set<std::string> m_usedSourceNames;
 	ContractDefinition const* m_mostDerivedContract = nullptr;
 	std::map<VariableDeclaration const*, IRVariable> m_localVariables;
+	std::set<VariableDeclaration const*> m_lazyStructCopies;
 	/// Memory offsets reserved for the values of immutable variables during contract creation.
 	/// This map is empty in the runtime context.
 	std::map<VariableDeclaration const*, size_t> m_immutableVariables;
@@ -209,6 +224,7 @@ private:
 	InternalDispatchMap m_internalDispatchMap;
 
 	std::set<ContractDefinition const*, ASTNode::CompareByID> m_subObjects;
+	std::map<std::string, bytes> m_constantData;
 
 	langutil::DebugInfoSelection m_debugInfoSelection = {};
 	langutil::CharStreamProvider const* m_soliditySourceProvider = nullptr;
@@ -24,6 +24,7 @@
 #include <libsolidity/codegen/ir/Common.h>
 #include <libsolidity/codegen/ir/IRGenerator.h>
 #include <libsolidity/codegen/ir/IRGeneratorForStatements.h>
+#include <libsolidity/codegen/ir/LazyStructCopyFinder.h>
 
 #include <libsolidity/ast/AST.h>
 #include <libsolidity/ast/ASTVisitor.h>
@@ -40,6 +41,7 @@
 
 #include <json/json.h>
 
+#include <algorithm>
 #include <sstream>
 #include <variant>
 
@@ -85,6 +87,62 @@ std::set<CallableDeclaration const*, ASTNode::CompareByID> collectReachableCalla
 	return reachableCallables;
 }
 
+/// @returns Yul code that calls the function whose internal function ID equals the
+/// variable ``fun`` among @a _cases, which are pairs of ID and function name sorted by ID.
+/// Large sets of cases are split at the median ID, so that selecting a function
+/// takes a logarithmic number of comparisons instead of a linear one.
+std::string internalDispatchSelector(
+	std::vector<std::pair<uint64_t, std::string>> const& _cases,
+	std::string const& _in,
+	std::string const& _out,
+	std::string const& _panic
+)
+{
+	// Splitting costs an additional comparison and jump, so it only
+	// pays off for more than four functions (see ContractCompiler::appendInternalSelector).
+	if (_cases.size() <= 4)
+	{
+		std::vector<std::map<std::string, std::string>> cases;
+		for (auto const& [funID, name]: _cases)
+			cases.emplace_back(std::map<std::string, std::string>{
+				{"funID", std::to_string(funID)},
+				{"name", name}
+			});
+		return Whiskers(R"(
+			switch fun
+			<#cases>
+			case <funID>
+			{
+				<?+out> <out> :=</+out> <name>(<in>)
+			}
+			</cases>
+			default { <panic>() }
+		)")
+		("cases", std::move(cases))
+		("in", _in)
+		("out", _out)
+		("panic", _panic)
+		.render();
+	}
+
+	size_t pivotIndex = _cases.size() / 2;
+	std::vector<std::pair<uint64_t, std::string>> smaller{_cases.begin(), _cases.begin() + static_cast<ptrdiff_t>(pivotIndex)};
+	std::vector<std::pair<uint64_t, std::string>> larger{_cases.begin() + static_cast<ptrdiff_t>(pivotIndex), _cases.end()};
+	return Whiskers(R"(
+		switch lt(fun, <pivot>)
+		case 0 {
+			<larger>
+		}
+		default {
+			<smaller>
+		}
+	)")
+	("pivot", std::to_string(_cases[pivotIndex].first))
+	("larger", internalDispatchSelector(larger, _in, _out, _panic))
+	("smaller", internalDispatchSelector(smaller, _in, _out, _panic))
+	.render();
+}
+
 }
 
 std::string IRGenerator::run(
@@ -109,6 +167,13 @@ std::string IRGenerator::generate(
 			subObjectsSources += _otherYulSources.at(subObject);
 		return subObjectsSources;
 	};
+	auto constantDataObjects = [](IRGenerationContext const& _context)
+	{
+		std::vector<std::map<std::string, std::string>> dataObjects;
+		for (auto const& [name, data]: _context.constantData())
+			dataObjects.push_back({{"name", name}, {"value", util::toHex(data)}});
+		return dataObjects;
+	};
 	auto formatUseSrcMap = [](IRGenerationContext const& _context) -> std::string
 	{
 		return joinHumanReadable(
@@ -146,9 +211,15 @@ std::string IRGenerator::generate(
 					<deployedFunctions>
 				}
 				<deployedSubObjects>
+				<#deployedData>
+				data "<name>" hex"<value>"
+				</deployedData>
 				data "<metadataName>" hex"<cborMetadata>"
 			}
 			<subObjects>
+			<#creationData>
+			data "<name>" hex"<value>"
+			</creationData>
 		}
 	)");
 
@@ -183,6 +254,7 @@ std::string IRGenerator::generate(
 
 	t("functions", m_context.functionCollector().requestedFunctions());
 	t("subObjects", subObjectSources(m_context.subObjectsCreated()));
+	t("creationData", constantDataObjects(m_context));
 
 	// This has to be called only after all other code generation for the creation object is complete.
 	bool creationInvolvesMemoryUnsafeAssembly = m_context.memoryUnsafeInlineAssemblySeen();
@@ -205,6 +277,7 @@ std::string IRGenerator::generate(
 	generateInternalDispatchFunctions(_contract);
 	t("deployedFunctions", m_context.functionCollector().requestedFunctions());
 	t("deployedSubObjects", subObjectSources(m_context.subObjectsCreated()));
+	t("deployedData", constantDataObjects(m_context));
 	t("metadataName", yul::Object::metadataName());
 	t("cborMetadata", util::toHex(_cborMetadata));
 
@@ -261,24 +334,18 @@ InternalDispatchMap IRGenerator::generateInternalDispatchFunctions(ContractDefin
 			Whiskers templ(R"(
 				<sourceLocationComment>
 				function <functionName>(fun<?+in>, <in></+in>) <?+out>-> <out></+out> {
-					switch fun
-					<#cases>
-					case <funID>
-					{
-						<?+out> <out> :=</+out> <name>(<in>)
-					}
-					</cases>
-					default { <panic>() }
+					<selector>
 				}
 				<sourceLocationComment>
 			)");
 			templ("sourceLocationComment", dispenseLocationComment(_contract));
 			templ("functionName", funName);
-			templ("panic", m_utils.panicFunction(PanicCode::InvalidInternalFunction));
-			templ("in", suffixedVariableNameList("in_", 0, arity.in));
-			templ("out", suffixedVariableNameList("out_", 0, arity.out));
+			std::string in = suffixedVariableNameList("in_", 0, arity.in);
+			std::string out = suffixedVariableNameList("out_", 0, arity.out);
+			templ("in", in);
+			templ("out", out);
 
-			std::vector<std::map<std::string, std::string>> cases;
+			std::vector<std::pair<uint64_t, std::string>> cases;
 			for (FunctionDefinition const* function: internalDispatchMap.at(arity))
 			{
 				solAssert(function, "");
@@ -291,13 +358,19 @@ InternalDispatchMap IRGenerator::generateInternalDispatchFunctions(ContractDefin
 				solAssert(function->id() != 0, "Unexpected function ID: 0");
 				solAssert(m_context.functionCollector().contains(IRNames::function(*function)), "");
 
-				cases.emplace_back(std::map<std::string, std::string>{
-					{"funID", std::to_string(m_context.mostDerivedContract().annotation().internalFunctionIDs.at(function))},
-					{"name", IRNames::function(*function)}
-				});
+				cases.emplace_back(
+					m_context.mostDerivedContract().annotation().internalFunctionIDs.at(function),
+					IRNames::function(*function)
+				);
 			}
+			std::sort(cases.begin(), cases.end());
 
-			templ("cases", std::move(cases));
+			templ("selector", internalDispatchSelector(
+				cases,
+				in,
+				out,
+				m_utils.panicFunction(PanicCode::InvalidInternalFunction)
+			));
 			return templ.render();
 		});
 	}
@@ -316,6 +389,7 @@ std::string IRGenerator::generateFunction(FunctionDefinition const& _function)
 	std::string functionName = IRNames::function(_function);
 	return m_context.functionCollector().createFunction(functionName, [&]() {
 		m_context.resetLocalVariables();
+		m_context.setLazyStructCopies(LazyStructCopyFinder::run(_function, m_evmVersion));
 		Whiskers t(R"(
 			<astIDComment><sourceLocationComment>
 			function <functionName>(<params>)<?+retParams> -> <retParams></+retParams> {
@@ -479,6 +553,7 @@ std::string IRGenerator::generateFunctionWithModifierInner(FunctionDefinition co
 	std::string functionName = IRNames::functionWithModifierInner(_function);
 	return m_context.functionCollector().createFunction(functionName, [&]() {
 		m_context.resetLocalVariables();
+		m_context.setLazyStructCopies(LazyStructCopyFinder::run(_function, m_evmVersion));
 		Whiskers t(R"(
 			<sourceLocationComment>
 			function <functionName>(<params>)<?+retParams> -> <retParams></+retParams> {
@@ -213,6 +213,71 @@ private:
 	ExternalRefsMap const& m_references;
 };
 
+/// @returns @a _argument if it is a call to string.concat, bytes.concat or abi.encodePacked
+/// of kind @a _kind, whose arguments can thus be passed to the enclosing call directly.
+FunctionCall const* flattenableCall(Expression const& _argument, FunctionType::Kind _kind)
+{
+	auto const* functionCall = dynamic_cast<FunctionCall const*>(&_argument);
+	if (!functionCall || *functionCall->annotation().kind != FunctionCallKind::FunctionCall)
+		return nullptr;
+	auto const* functionType = dynamic_cast<FunctionType const*>(functionCall->expression().annotation().type);
+	if (!functionType || functionType->kind() != _kind)
+		return nullptr;
+	return functionCall;
+}
+
+/**
+ * Determines whether evaluating an expression can modify memory or storage, i.e. whether
+ * it contains assignments, increments, decrements, deletes or function calls other than
+ * type conversions, struct constructors and concatenations.
+ */
+class SideEffectsFinder: private ASTConstVisitor
+{
+public:
+	static bool hasSideEffects(Expression const& _expression)
+	{
+		SideEffectsFinder finder;
+		_expression.accept(finder);
+		return finder.m_sideEffects;
+	}
+
+private:
+	bool visit(Assignment const&) override
+	{
+		m_sideEffects = true;
+		return false;
+	}
+	bool visit(UnaryOperation const& _operation) override
+	{
+		if (
+			_operation.getOperator() == Token::Inc ||
+			_operation.getOperator() == Token::Dec ||
+			_operation.getOperator() == Token::Delete
+		)
+			m_sideEffects = true;
+		return !m_sideEffects;
+	}
+	bool visit(FunctionCall const& _functionCall) override
+	{
+		if (*_functionCall.annotation().kind == FunctionCallKind::FunctionCall)
+		{
+			auto const* functionType = dynamic_cast<FunctionType const*>(_functionCall.expression().annotation().type);
+			if (
+				!functionType ||
+				(
+					functionType->kind() != FunctionType::Kind::StringConcat &&
+					functionType->kind() != FunctionType::Kind::BytesConcat &&
+					functionType->kind() != FunctionType::Kind::ABIEncodePacked
+				)
+			)
+				m_sideEffects = true;
+		}
+		return !m_sideEffects;
+	}
+
+	bool m_sideEffects = false;
+};
+
 }
 
 std::string IRGeneratorForStatementsBase::code() const
@@ -391,7 +456,11 @@ void IRGeneratorForStatements::endVisit(VariableDeclarationStatement const& _var
 		else
 		{
 			VariableDeclaration const& varDecl = *_varDeclStatement.declarations().front();
-			define(m_context.addLocalVariable(varDecl), *expression);
+			if (m_context.isLazyStructCopy(varDecl))
+				// Keep the reference to storage, members are read from there when accessed.
+				define(m_context.addLocalVariable(varDecl, type(*expression)), *expression);
+			else
+				define(m_context.addLocalVariable(varDecl), *expression);
 		}
 	}
 	else
@@ -931,6 +1000,37 @@ bool IRGeneratorForStatements::visit(BinaryOperation const& _binOp)
 	return false;
 }
 
+bool IRGeneratorForStatements::visit(FunctionCall const& _functionCall)
+{
+	// Nested concatenations are flattened into the outermost one, so that no intermediate
+	// results are allocated and copied. The evaluation order of the arguments is unchanged,
+	// but the arguments of a nested call are only read after the arguments following it are
+	// evaluated, so this is only done if these cannot modify memory or storage.
+	// If the enclosing call is itself flattened, this already holds for its following arguments.
+	if (auto const* functionType = dynamic_cast<FunctionType const*>(_functionCall.expression().annotation().type))
+		switch (functionType->kind())
+		{
+		case FunctionType::Kind::StringConcat:
+		case FunctionType::Kind::BytesConcat:
+		case FunctionType::Kind::ABIEncodePacked:
+		{
+			auto const& arguments = _functionCall.arguments();
+			bool followingSideEffects = false;
+			for (size_t i = arguments.size(); i > 0; --i)
+			{
+				if (!followingSideEffects)
+					if (FunctionCall const* nestedCall = flattenableCall(*arguments[i - 1], functionType->kind()))
+						m_flattenedCalls.insert(nestedCall);
+				followingSideEffects = followingSideEffects || SideEffectsFinder::hasSideEffects(*arguments[i - 1]);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	return true;
+}
+
 void IRGeneratorForStatements::endVisit(FunctionCall const& _functionCall)
 {
 	setLocation(_functionCall);
@@ -1151,6 +1251,20 @@ void IRGeneratorForStatements::endVisit(FunctionCall const& _functionCall)
 			arguments.size() > 1 && m_context.revertStrings() != RevertStrings::Strip ?
 			arguments[1]->annotation().type :
 			nullptr;
+		std::optional<bytes> constantErrorData;
+		if (messageArgumentType)
+			constantErrorData = CompilerUtils::constantErrorData(
+				"Error(string)",
+				{TypeProvider::stringMemory()},
+				{messageArgumentType}
+			);
+		if (constantErrorData)
+		{
+			appendCode() <<
+				"if iszero(" << IRVariable(*arguments[0]).name() << ") { " <<
+				revertWithConstantDataFunction(*constantErrorData) << "() }\n";
+			break;
+		}
 		std::string requireOrAssertFunction = m_utils.requireOrAssertFunction(
 			functionType->kind() == FunctionType::Kind::Assert,
 			messageArgumentType
@@ -1195,6 +1309,13 @@ void IRGeneratorForStatements::endVisit(FunctionCall const& _functionCall)
 			else
 				argumentsOfEncodeFunction.push_back(arguments[1]);
 		}
+		else if (isPacked)
+		{
+			if (m_flattenedCalls.count(&_functionCall))
+				// Encoded as part of the enclosing call.
+				break;
+			argumentsOfEncodeFunction = flattenedArguments(_functionCall);
+		}
 		else
 			for (size_t i = 0; i < arguments.size(); ++i)
 			{
@@ -1451,9 +1572,12 @@ void IRGeneratorForStatements::endVisit(FunctionCall const& _functionCall)
 	case FunctionType::Kind::StringConcat:
 	case FunctionType::Kind::BytesConcat:
 	{
+		if (m_flattenedCalls.count(&_functionCall))
+			// Concatenated as part of the enclosing call.
+			break;
 		TypePointers argumentTypes;
 		std::vector<std::string> argumentVars;
-		for (ASTPointer<Expression const> const& argument: arguments)
+		for (ASTPointer<Expression const> const& argument: flattenedArguments(_functionCall))
 		{
 			argumentTypes.emplace_back(&type(*argument));
 			argumentVars += IRVariable(*argument).stackSlots();
@@ -1975,9 +2099,16 @@ void IRGeneratorForStatements::endVisit(MemberAccess const& _memberAccess)
 		break;
 	case Type::Category::Struct:
 	{
-		auto const& structType = dynamic_cast<StructType const&>(*_memberAccess.expression().annotation().type);
+		VariableDeclaration const* lazyStructCopy = nullptr;
+		if (auto const* identifier = dynamic_cast<Identifier const*>(&_memberAccess.expression()))
+			if (auto const* variable = dynamic_cast<VariableDeclaration const*>(identifier->annotation().referencedDeclaration))
+				if (m_context.isLazyStructCopy(*variable))
+					lazyStructCopy = variable;
 
-		IRVariable expression(_memberAccess.expression());
+		IRVariable expression = lazyStructCopy ?
+			m_context.localVariable(*lazyStructCopy) :
+			IRVariable(_memberAccess.expression());
+		auto const& structType = dynamic_cast<StructType const&>(expression.type());
 		switch (structType.location())
 		{
 		case DataLocation::Storage:
@@ -2521,6 +2652,10 @@ void IRGeneratorForStatements::handleVariableReference(
 			*_variable.annotation().type,
 			IRLValue::Immutable{&_variable}
 		});
+	else if (m_context.isLazyStructCopy(_variable))
+	{
+		// Only members of the variable are read, which is handled in endVisit(MemberAccess).
+	}
 	else if (m_context.isLocalVariable(_variable))
 		setLValue(_referencingExpression, IRLValue{
 			*_variable.annotation().type,
@@ -2558,6 +2693,12 @@ void IRGeneratorForStatements::appendExternalFunctionCall(
 	bool const useStaticCall = funType.stateMutability() <= StateMutability::View && m_context.evmVersion().hasStaticCall();
 
 	ReturnInfo const returnInfo{m_context.evmVersion(), funType};
+	// Static return values that are single words are decoded straight from the return data,
+	// so that no output area has to be reserved in memory.
+	bool const decodeFromReturndata =
+		!returnInfo.dynamicReturnSize &&
+		m_context.evmVersion().supportsReturndata() &&
+		m_context.abiFunctions().decodableFromReturndata(returnInfo.returnTypes);
 
 	TypePointers parameterTypes = funType.parameterTypes();
 	TypePointers argumentTypes;
@@ -2582,7 +2723,7 @@ void IRGeneratorForStatements::appendExternalFunctionCall(
 		// (which we would have to subtract from the gas left)
 		// We could also just use MLOAD; POP right before the gas calculation, but the optimizer
 		// would remove that, so we use MSTORE here.
-		if (!funType.gasSet() && returnInfo.estimatedReturnSize > 0)
+		if (!funType.gasSet() && returnInfo.estimatedReturnSize > 0 && !decodeFromReturndata)
 			appendCode() << "mstore(add(" << m_utils.allocateUnboundedFunction() << "() , " << std::to_string(returnInfo.estimatedReturnSize) << "), 0)\n";
 	}
 
@@ -2603,6 +2744,9 @@ void IRGeneratorForStatements::appendExternalFunctionCall(
 		</noTryCall>
 		<?+retVars> let <retVars> </+retVars>
 		if <success> {
+		<?decodeFromReturndata>
+			<retVars> := <abiDecodeFromReturndata>()
+		<!decodeFromReturndata>
 			<?isReturndataSizeDynamic>
 				let <returnDataSizeVar> := returndatasize()
 				returndatacopy(<pos>, 0, <returnDataSizeVar>)
@@ -2620,6 +2764,7 @@ void IRGeneratorForStatements::appendExternalFunctionCall(
 
 			// decode return parameters from external try-call into retVars
 			<?+retVars> <retVars> := </+retVars> <abiDecode>(<pos>, add(<pos>, <returnDataSizeVar>))
+		</decodeFromReturndata>
 		}
 	)");
 	templ("revertNoCode", m_utils.revertReasonIfDebugFunction("Target contract does not contain code"));
@@ -2651,14 +2796,18 @@ void IRGeneratorForStatements::appendExternalFunctionCall(
 	if (returnInfo.dynamicReturnSize)
 		solAssert(m_context.evmVersion().supportsReturndata());
 	templ("returnDataSizeVar", m_context.newYulVariable());
-	templ("staticReturndataSize", std::to_string(returnInfo.estimatedReturnSize));
+	templ("staticReturndataSize", decodeFromReturndata ? "0" : std::to_string(returnInfo.estimatedReturnSize));
 	templ("supportsReturnData", m_context.evmVersion().supportsReturndata());
 
 	std::string const retVars = IRVariable(_functionCall).commaSeparatedList();
 	templ("retVars", retVars);
 	solAssert(retVars.empty() == returnInfo.returnTypes.empty());
 
-	templ("abiDecode", m_context.abiFunctions().tupleDecoder(returnInfo.returnTypes, true));
+	templ("decodeFromReturndata", decodeFromReturndata);
+	if (decodeFromReturndata)
+		templ("abiDecodeFromReturndata", m_context.abiFunctions().tupleDecoderFromReturndata(returnInfo.returnTypes));
+	else
+		templ("abiDecode", m_context.abiFunctions().tupleDecoder(returnInfo.returnTypes, true));
 	templ("isReturndataSizeDynamic", returnInfo.dynamicReturnSize);
 
 	templ("noTryCall", !_functionCall.annotation().tryCall);
@@ -3236,6 +3385,17 @@ void IRGeneratorForStatements::generateLoop(
 	appendCode() << "}\n";
 }
 
+std::vector<ASTPointer<Expression const>> IRGeneratorForStatements::flattenedArguments(FunctionCall const& _functionCall) const
+{
+	std::vector<ASTPointer<Expression const>> arguments;
+	for (ASTPointer<Expression const> const& argument: _functionCall.arguments())
+		if (auto const* nestedCall = dynamic_cast<FunctionCall const*>(argument.get()); nestedCall && m_flattenedCalls.count(nestedCall))
+			arguments += flattenedArguments(*nestedCall);
+		else
+			arguments.push_back(argument);
+	return arguments;
+}
+
 Type const& IRGeneratorForStatements::type(Expression const& _expression)
 {
 	solAssert(_expression.annotation().type, "Type of expression not set.");
@@ -3365,6 +3525,20 @@ void IRGeneratorForStatements::revertWithError(
 	std::vector<ASTPointer<Expression const>> const& _errorArguments
 )
 {
+	std::vector<std::string> errorArgumentVars;
+	std::vector<Type const*> errorArgumentTypes;
+	for (ASTPointer<Expression const> const& arg: _errorArguments)
+	{
+		errorArgumentVars += IRVariable(*arg).stackSlots();
+		solAssert(arg->annotation().type);
+		errorArgumentTypes.push_back(arg->annotation().type);
+	}
+	if (auto data = CompilerUtils::constantErrorData(_signature, _parameterTypes, errorArgumentTypes))
+	{
+		appendCode() << revertWithConstantDataFunction(*data) << "()\n";
+		return;
+	}
+
 	Whiskers templ(R"({
 		let <pos> := <allocateUnbounded>()
 		mstore(<pos>, <hash>)
@@ -3375,21 +3549,31 @@ void IRGeneratorForStatements::revertWithError(
 	templ("end", m_context.newYulVariable());
 	templ("hash", util::selectorFromSignatureU256(_signature).str());
 	templ("allocateUnbounded", m_utils.allocateUnboundedFunction());
-
-	std::vector<std::string> errorArgumentVars;
-	std::vector<Type const*> errorArgumentTypes;
-	for (ASTPointer<Expression const> const& arg: _errorArguments)
-	{
-		errorArgumentVars += IRVariable(*arg).stackSlots();
-		solAssert(arg->annotation().type);
-		errorArgumentTypes.push_back(arg->annotation().type);
-	}
 	templ("argumentVars", joinHumanReadablePrefixed(errorArgumentVars));
 	templ("encode", m_context.abiFunctions().tupleEncoder(errorArgumentTypes, _parameterTypes));
 
 	appendCode() << templ.render();
 }
 
+std::string IRGeneratorForStatements::revertWithConstantDataFunction(bytes const& _data)
+{
+	std::string dataName = m_context.registerConstantData(_data);
+	std::string functionName = "revert_with_" + dataName;
+	return m_context.functionCollector().createFunction(functionName, [&] {
+		return Whiskers(R"(
+			function <functionName>() {
+				let pos := <allocateUnbounded>()
+				datacopy(pos, dataoffset("<dataName>"), datasize("<dataName>"))
+				revert(pos, datasize("<dataName>"))
+			}
+		)")
+		("functionName", functionName)
+		("allocateUnbounded", m_utils.allocateUnboundedFunction())
+		("dataName", dataName)
+		.render();
+	});
+}
+
 
 bool IRGeneratorForStatements::visit(TryCatchClause const& _clause)
 {
@@ -26,6 +26,7 @@
 #include <libsolidity/codegen/ir/IRVariable.h>
 
 #include <functional>
+#include <set>
 
 namespace solidity::frontend
 {
@@ -120,6 +121,7 @@ public:
 	void endVisit(Return const& _return) override;
 	bool visit(UnaryOperation const& _unaryOperation) override;
 	bool visit(BinaryOperation const& _binOp) override;
+	bool visit(FunctionCall const& _funCall) override;
 	void endVisit(FunctionCall const& _funCall) override;
 	void endVisit(FunctionCallOptions const& _funCallOptions) override;
 	bool visit(MemberAccess const& _memberAccess) override;
@@ -147,6 +149,10 @@ private:
 		std::vector<ASTPointer<Expression const>> const& _errorArguments
 	);
 
+	/// @returns the name of a function that reverts with @a _data, which is copied from
+	/// a data object of the current Yul object.
+	std::string revertWithConstantDataFunction(bytes const& _data);
+
 	void handleVariableReference(
 		VariableDeclaration const& _variable,
 		Expression const& _referencingExpression
@@ -240,11 +246,20 @@ private:
 
 	static Type const& type(Expression const& _expression);
 
+	/// @returns the arguments of @a _functionCall, where the arguments of nested calls in
+	/// m_flattenedCalls are included in place of these calls.
+	std::vector<ASTPointer<Expression const>> flattenedArguments(FunctionCall const& _functionCall) const;
+
 	std::string linkerSymbol(ContractDefinition const& _library) const;
 
 	std::function<std::string()> m_placeholderCallback;
 	YulUtilFunctions& m_utils;
 	std::optional<IRLValue> m_currentLValue;
+	/// Calls to string.concat, bytes.concat and abi.encodePacked that are direct arguments of
+	/// a call of the same kind. They do not produce a value on their own, but their arguments
+	/// are part of the enclosing call, so that only a single memory area is allocated and
+	/// written to.
+	std::set<FunctionCall const*> m_flattenedCalls;
 };
 
 }
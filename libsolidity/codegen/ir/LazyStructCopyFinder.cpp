@@ -0,0 +1,162 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/codegen/ir/LazyStructCopyFinder.h>
+
+#include <libsolidity/ast/AST.h>
+
+using namespace solidity;
+using namespace solidity::frontend;
+
+namespace
+{
+
+/**
+ * Finds external calls to library functions, including the ones made by the internal functions
+ * and modifiers called from the visited code. Internal calls whose target cannot be determined
+ * statically are treated like such calls.
+ */
+class DelegateCallFinder: private ASTConstVisitor
+{
+public:
+	static bool run(Block const& _body)
+	{
+		DelegateCallFinder finder;
+		_body.accept(finder);
+		return finder.m_found;
+	}
+
+private:
+	bool visit(FunctionCall const& _functionCall) override
+	{
+		auto const* functionType = dynamic_cast<FunctionType const*>(_functionCall.expression().annotation().type);
+		if (*_functionCall.annotation().kind != FunctionCallKind::FunctionCall || !functionType)
+			return !m_found;
+
+		if (functionType->kind() == FunctionType::Kind::DelegateCall)
+			m_found = true;
+		else if (functionType->kind() == FunctionType::Kind::Internal)
+		{
+			auto const* function = dynamic_cast<FunctionDefinition const*>(
+				ASTNode::referencedDeclaration(_functionCall.expression())
+			);
+			if (!function || function->virtualSemantics() || !function->isImplemented())
+				m_found = true;
+			else if (m_visited.insert(function).second)
+			{
+				for (auto const& modifier: function->modifiers())
+					visitModifier(*modifier);
+				function->body().accept(*this);
+			}
+		}
+		return !m_found;
+	}
+
+	void visitModifier(ModifierInvocation const& _invocation)
+	{
+		auto const* modifier = dynamic_cast<ModifierDefinition const*>(_invocation.name().annotation().referencedDeclaration);
+		if (!modifier || modifier->virtualSemantics() || !modifier->isImplemented())
+			m_found = true;
+		else if (m_visited.insert(modifier).second)
+			modifier->body().accept(*this);
+	}
+
+	bool m_found = false;
+	std::set<CallableDeclaration const*> m_visited;
+};
+
+}
+
+std::set<VariableDeclaration const*> LazyStructCopyFinder::run(
+	FunctionDefinition const& _function,
+	langutil::EVMVersion _evmVersion
+)
+{
+	// Without STATICCALL, calls to view functions of other contracts can re-enter
+	// and modify storage.
+	if (
+		_function.stateMutability() != StateMutability::View ||
+		!_function.isImplemented() ||
+		!_evmVersion.hasStaticCall()
+	)
+		return {};
+
+	// Library functions called via DELEGATECALL can modify storage even if they are view functions.
+	if (DelegateCallFinder::run(_function.body()))
+		return {};
+
+	LazyStructCopyFinder finder;
+	_function.body().accept(finder);
+
+	std::set<VariableDeclaration const*> lazyCopies;
+	for (VariableDeclaration const* variable: finder.m_candidates)
+		if (!finder.m_otherUses.count(variable))
+			lazyCopies.insert(variable);
+	return lazyCopies;
+}
+
+bool LazyStructCopyFinder::visit(VariableDeclarationStatement const& _statement)
+{
+	if (_statement.declarations().size() != 1 || !_statement.declarations().front() || !_statement.initialValue())
+		return true;
+
+	VariableDeclaration const& variable = *_statement.declarations().front();
+	auto const* variableType = dynamic_cast<StructType const*>(variable.annotation().type);
+	auto const* valueType = dynamic_cast<StructType const*>(_statement.initialValue()->annotation().type);
+	if (
+		variableType &&
+		valueType &&
+		variableType->location() == DataLocation::Memory &&
+		valueType->location() == DataLocation::Storage
+	)
+		m_candidates.insert(&variable);
+	return true;
+}
+
+bool LazyStructCopyFinder::visit(MemberAccess const& _memberAccess)
+{
+	auto const* identifier = dynamic_cast<Identifier const*>(&_memberAccess.expression());
+	if (!identifier)
+		return true;
+	auto const* member = dynamic_cast<VariableDeclaration const*>(_memberAccess.annotation().referencedDeclaration);
+	if (
+		member &&
+		member->isStructMember() &&
+		_memberAccess.annotation().type->isValueType() &&
+		!_memberAccess.annotation().willBeWrittenTo
+	)
+		// Reading a member of value type is the only use that does not need a copy,
+		// so the identifier itself is not visited.
+		return false;
+	return true;
+}
+
+bool LazyStructCopyFinder::visit(Identifier const& _identifier)
+{
+	if (auto const* variable = dynamic_cast<VariableDeclaration const*>(_identifier.annotation().referencedDeclaration))
+		m_otherUses.insert(variable);
+	return false;
+}
+
+bool LazyStructCopyFinder::visit(InlineAssembly const& _inlineAssembly)
+{
+	for (auto const& reference: _inlineAssembly.annotation().externalReferences)
+		if (auto const* variable = dynamic_cast<VariableDeclaration const*>(reference.second.declaration))
+			m_otherUses.insert(variable);
+	return false;
+}
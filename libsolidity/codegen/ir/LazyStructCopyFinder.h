@@ -0,0 +1,66 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Analysis that finds memory copies of storage structs that can be replaced by
+ * reading the accessed members from storage.
+ */
+
+#pragma once
+
+#include <libsolidity/ast/ASTVisitor.h>
+
+#include <liblangutil/EVMVersion.h>
+
+#include <set>
+
+namespace solidity::frontend
+{
+
+/**
+ * Finds local variables of memory struct type inside the body of a view function that are
+ * initialized with a storage struct and are only used to read members of value type.
+ *
+ * A view function cannot write to storage itself and its calls to other contracts use STATICCALL,
+ * so storage does not change while it runs, unless it calls an external library function, which
+ * uses DELEGATECALL and runs code that is not known at compile time. Functions that may
+ * perform such a call, directly or through the internal functions and modifiers they call,
+ * are skipped. Otherwise reading such a member from storage when it is accessed yields the
+ * same value as reading it from a copy made at the declaration. This avoids loading members
+ * that are never used.
+ */
+class LazyStructCopyFinder: private ASTConstVisitor
+{
+public:
+	static std::set<VariableDeclaration const*> run(
+		FunctionDefinition const& _function,
+		langutil::EVMVersion _evmVersion
+	);
+
+private:
+	bool visit(VariableDeclarationStatement const& _statement) override;
+	bool visit(MemberAccess const& _memberAccess) override;
+	bool visit(Identifier const& _identifier) override;
+	bool visit(InlineAssembly const& _inlineAssembly) override;
+
+	/// Local memory struct variables initialized with a storage struct.
+	std::set<VariableDeclaration const*> m_candidates;
+	/// Variables that are referenced other than to read a member of value type.
+	std::set<VariableDeclaration const*> m_otherUses;
+};
+
+}
@@ -310,6 +310,7 @@ void CompilerStack::reset(bool _keepSettings)
 	m_sources.clear();
 	m_smtlib2Responses.clear();
 	m_unhandledSMTLib2Queries.clear();
+	m_telemetry.clear();
 	if (!_keepSettings)
 	{
 		m_importRemapper.clear();
@@ -318,6 +319,7 @@ void CompilerStack::reset(bool _keepSettings)
 		m_evmVersion = langutil::EVMVersion();
 		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_generateIR = false;
+		m_telemetryEnabled = false;
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
 		m_metadataLiteralSources = false;
@@ -338,8 +340,8 @@ void CompilerStack::setSources(StringMap _sources)
 		solThrow(CompilerError, "Cannot change sources once set.");
 	if (m_stackState != Empty)
 		solThrow(CompilerError, "Must set sources before parsing.");
-	for (auto source: _sources)
-		m_sources[source.first].charStream = std::make_unique<CharStream>(/*content*/std::move(source.second), /*name*/source.first);
+	for (auto& [name, content]: _sources)
+		m_sources[name].charStream = std::make_unique<CharStream>(std::move(content), name);
 	m_stackState = SourcesSet;
 }
 
@@ -348,6 +350,7 @@ bool CompilerStack::parse()
 	if (m_stackState != SourcesSet)
 		solThrow(CompilerError, "Must call parse only after the SourcesSet state.");
 	m_errorReporter.clear();
+	util::ScopedPhaseMeasurement measurement(telemetryLog(), "parsing");
 
 	if (SemVerVersion{std::string(VersionString)}.isPrerelease())
 		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
@@ -414,6 +417,7 @@ void CompilerStack::importASTs(std::map<std::string, Json::Value> const& _source
 {
 	if (m_stackState != Empty)
 		solThrow(CompilerError, "Must call importASTs only before the SourcesSet state.");
+	util::ScopedPhaseMeasurement measurement(telemetryLog(), "importing");
 	std::map<std::string, ASTPointer<SourceUnit>> reconstructedSources = ASTJsonImporter(m_evmVersion).jsonToSourceUnit(_sources);
 	for (auto& src: reconstructedSources)
 	{
@@ -437,6 +441,7 @@ bool CompilerStack::analyze()
 {
 	if (m_stackState != ParsedAndImported)
 		solThrow(CompilerError, "Must call analyze only after parsing was successful.");
+	util::ScopedPhaseMeasurement measurement(telemetryLog(), "analysis");
 
 	if (!resolveImports())
 		return false;
@@ -507,10 +512,13 @@ bool CompilerStack::analyze()
 		//
 		// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 		// which is only done one step later.
-		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
-				noErrors = false;
+		{
+			util::ScopedPhaseMeasurement typeCheckingMeasurement(telemetryLog(), "analysis/typeChecking");
+			TypeChecker typeChecker(m_evmVersion, m_errorReporter);
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
+					noErrors = false;
+		}
 
 		if (noErrors)
 		{
@@ -598,6 +606,7 @@ bool CompilerStack::analyze()
 		if (noErrors)
 		{
 			// Run SMTChecker
+			util::ScopedPhaseMeasurement modelCheckingMeasurement(telemetryLog(), "analysis/modelChecking");
 
 			auto allSources = util::applyMap(m_sourceOrder, [](Source const* _source) { return _source->ast; });
 			if (ModelChecker::isPragmaPresent(allSources))
@@ -677,6 +686,8 @@ bool CompilerStack::compile(State _stopAfter)
 	if (m_stackState >= m_stopAfter)
 		return true;
 
+	util::ScopedPhaseMeasurement measurement(telemetryLog(), "compilation");
+
 	// Only compile contracts individually which have been requested.
 	std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> otherCompilers;
 
@@ -743,6 +754,17 @@ void CompilerStack::link()
 	}
 }
 
+Json::Value CompilerStack::telemetryJson() const
+{
+	Json::Value phases{Json::arrayValue};
+	for (util::PhaseMeasurement const& measurement: m_telemetry)
+		phases.append(measurement.toJson());
+
+	Json::Value telemetry{Json::objectValue};
+	telemetry["phases"] = std::move(phases);
+	return telemetry;
+}
+
 std::vector<std::string> CompilerStack::contractNames() const
 {
 	if (m_stackState < Parsed)
@@ -856,6 +878,36 @@ std::string const* CompilerStack::runtimeSourceMapping(std::string const& _contr
 	return c.runtimeSourceMapping ? &*c.runtimeSourceMapping : nullptr;
 }
 
+bytes const* CompilerStack::binarySourceMapping(std::string const& _contractName) const
+{
+	if (m_stackState != CompilationSuccessful)
+		solThrow(CompilerError, "Compilation was not successful.");
+
+	Contract const& c = contract(_contractName);
+	if (!c.binarySourceMapping)
+	{
+		if (auto items = assemblyItems(_contractName))
+			c.binarySourceMapping.emplace(evmasm::AssemblyItem::computeBinarySourceMapping(*items, sourceIndices()));
+	}
+	return c.binarySourceMapping ? &*c.binarySourceMapping : nullptr;
+}
+
+bytes const* CompilerStack::runtimeBinarySourceMapping(std::string const& _contractName) const
+{
+	if (m_stackState != CompilationSuccessful)
+		solThrow(CompilerError, "Compilation was not successful.");
+
+	Contract const& c = contract(_contractName);
+	if (!c.runtimeBinarySourceMapping)
+	{
+		if (auto items = runtimeAssemblyItems(_contractName))
+			c.runtimeBinarySourceMapping.emplace(
+				evmasm::AssemblyItem::computeBinarySourceMapping(*items, sourceIndices())
+			);
+	}
+	return c.runtimeBinarySourceMapping ? &*c.runtimeBinarySourceMapping : nullptr;
+}
+
 std::string const CompilerStack::filesystemFriendlyName(std::string const& _contractName) const
 {
 	if (m_stackState < AnalysisSuccessful)
@@ -1133,17 +1185,23 @@ size_t CompilerStack::functionEntryPoint(
 	return 0;
 }
 
+bytesConstRef CompilerStack::Source::content() const
+{
+	std::string_view source = charStream->source();
+	return bytesConstRef(reinterpret_cast<uint8_t const*>(source.data()), source.size());
+}
+
 h256 const& CompilerStack::Source::keccak256() const
 {
 	if (keccak256HashCached == h256{})
-		keccak256HashCached = util::keccak256(charStream->source());
+		keccak256HashCached = util::keccak256(content());
 	return keccak256HashCached;
 }
 
 h256 const& CompilerStack::Source::swarmHash() const
 {
 	if (swarmHashCached == h256{})
-		swarmHashCached = util::bzzr1Hash(charStream->source());
+		swarmHashCached = util::bzzr1Hash(content());
 	return swarmHashCached;
 }
 
@@ -1173,7 +1231,7 @@ StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast)
 					result = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), importPath);
 
 				if (result.success)
-					newSources[importPath] = result.responseOrErrorMessage;
+					newSources[importPath] = std::move(result.responseOrErrorMessage);
 				else
 				{
 					m_errorReporter.parserError(
@@ -1319,6 +1377,7 @@ void CompilerStack::assembleYul(
 )
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "");
+	util::ScopedPhaseMeasurement measurement(telemetryLog(), "compilation/assembly", _contract.fullyQualifiedName());
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
@@ -1413,6 +1472,7 @@ void CompilerStack::compileContract(
 	try
 	{
 		// Run optimiser and compile the contract.
+		util::ScopedPhaseMeasurement measurement(telemetryLog(), "compilation/evmCodeGeneration", _contract.fullyQualifiedName());
 		compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
 	}
 	catch(evmasm::OptimizerException const&)
@@ -1460,11 +1520,14 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		m_debugInfoSelection,
 		this
 	);
-	compiledContract.yulIR = generator.run(
-		_contract,
-		createCBORMetadata(compiledContract, /* _forIR */ true),
-		otherYulSources
-	);
+	{
+		util::ScopedPhaseMeasurement measurement(telemetryLog(), "compilation/irGeneration", _contract.fullyQualifiedName());
+		compiledContract.yulIR = generator.run(
+			_contract,
+			createCBORMetadata(compiledContract, /* _forIR */ true),
+			otherYulSources
+		);
+	}
 
 	yul::YulStack stack(
 		m_evmVersion,
@@ -1482,7 +1545,10 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	);
 
 	compiledContract.yulIRAst = stack.astJson();
-	stack.optimize();
+	{
+		util::ScopedPhaseMeasurement measurement(telemetryLog(), "compilation/yulOptimization", _contract.fullyQualifiedName());
+		stack.optimize();
+	}
 	compiledContract.yulIROptimized = stack.print(this);
 	compiledContract.yulIROptimizedAst = stack.astJson();
 }
@@ -1514,7 +1580,10 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 
 	std::string deployedName = IRNames::deployedObject(_contract);
 	solAssert(!deployedName.empty(), "");
-	tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack.assembleEVMWithDeployed(deployedName);
+	{
+		util::ScopedPhaseMeasurement measurement(telemetryLog(), "compilation/evmCodeGeneration", _contract.fullyQualifiedName());
+		tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack.assembleEVMWithDeployed(deployedName);
+	}
 	assembleYul(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
 }
 
@@ -1592,7 +1661,7 @@ std::string CompilerStack::createMetadata(Contract const& _contract, bool _forIR
 		if (std::optional<std::string> licenseString = s.second.ast->licenseString())
 			meta["sources"][s.first]["license"] = *licenseString;
 		if (m_metadataLiteralSources)
-			meta["sources"][s.first]["content"] = s.second.charStream->source();
+			meta["sources"][s.first]["content"] = std::string(s.second.charStream->source());
 		else
 		{
 			meta["sources"][s.first]["urls"] = Json::arrayValue;
@@ -1619,6 +1688,9 @@ std::string CompilerStack::createMetadata(Contract const& _contract, bool _forIR
 
 		details["orderLiterals"] = m_optimiserSettings.runOrderLiterals;
 		details["inliner"] = m_optimiserSettings.runInliner;
+		// Only present if enabled to keep the metadata of existing settings unchanged.
+		if (m_optimiserSettings.shareModifierCode)
+			details["shareModifierCode"] = true;
 		details["jumpdestRemover"] = m_optimiserSettings.runJumpdestRemover;
 		details["peephole"] = m_optimiserSettings.runPeephole;
 		details["deduplicate"] = m_optimiserSettings.runDeduplicate;
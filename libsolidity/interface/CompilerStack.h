@@ -46,6 +46,7 @@
 #include <libsolutil/Common.h>
 #include <libsolutil/FixedHash.h>
 #include <libsolutil/LazyInit.h>
+#include <libsolutil/Telemetry.h>
 
 #include <json/json.h>
 
@@ -189,6 +190,10 @@ public:
 	/// Enable generation of Yul IR code.
 	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
 
+	/// Enable collection of wall time and memory usage per compilation phase and contract.
+	/// The results are available via @a telemetry() and @a telemetryJson().
+	void enableTelemetry(bool _enable = true) { m_telemetryEnabled = _enable; }
+
 	/// @arg _metadataLiteralSources When true, store sources as literals in the contract metadata.
 	/// Must be set before parsing.
 	void useMetadataLiteralSources(bool _metadataLiteralSources);
@@ -250,6 +255,13 @@ public:
 	/// by calling @a addSMTLib2Response).
 	std::vector<std::string> const& unhandledSMTLib2Queries() const { return m_unhandledSMTLib2Queries; }
 
+	/// @returns the resource usage of the phases run so far, in the order in which they finished.
+	/// Empty unless telemetry was enabled.
+	std::vector<util::PhaseMeasurement> const& telemetry() const { return m_telemetry; }
+
+	/// @returns the output of @a telemetry() as a JSON object.
+	Json::Value telemetryJson() const;
+
 	/// @returns a list of the contract names in the sources.
 	std::vector<std::string> contractNames() const;
 
@@ -295,6 +307,16 @@ public:
 	/// if the contract does not (yet) have bytecode.
 	std::string const* runtimeSourceMapping(std::string const& _contractName) const;
 
+	/// @returns the source mapping of the bytecode in the binary format of
+	/// evmasm::AssemblyItem::computeBinarySourceMapping or a nullptr if the contract
+	/// does not (yet) have bytecode.
+	bytes const* binarySourceMapping(std::string const& _contractName) const;
+
+	/// @returns the source mapping of the runtime bytecode in the binary format of
+	/// evmasm::AssemblyItem::computeBinarySourceMapping or a nullptr if the contract
+	/// does not (yet) have bytecode.
+	bytes const* runtimeBinarySourceMapping(std::string const& _contractName) const;
+
 	/// @return a verbose text representation of the assembly.
 	/// @arg _sourceCodes is the map of input files to source code strings
 	/// Prerequisite: Successful compilation.
@@ -356,6 +378,8 @@ private:
 		util::h256 mutable swarmHashCached;
 		std::string mutable ipfsUrlCached;
 		void reset() { *this = Source(); }
+		/// @returns the source text as bytes without copying it out of the char stream.
+		bytesConstRef content() const;
 		util::h256 const& keccak256() const;
 		util::h256 const& swarmHash() const;
 		std::string const& ipfsUrl() const;
@@ -383,6 +407,8 @@ private:
 		util::LazyInit<Json::Value const> runtimeGeneratedSources;
 		mutable std::optional<std::string const> sourceMapping;
 		mutable std::optional<std::string const> runtimeSourceMapping;
+		mutable std::optional<bytes const> binarySourceMapping;
+		mutable std::optional<bytes const> runtimeBinarySourceMapping;
 	};
 
 	void createAndAssignCallGraphs();
@@ -471,6 +497,9 @@ private:
 	/// This will generate the metadata and store it in the Contract object if it is not present yet.
 	std::string const& metadata(Contract const& _contract) const;
 
+	/// @returns the log phase measurements are appended to or nullptr if telemetry is disabled.
+	std::vector<util::PhaseMeasurement>* telemetryLog() { return m_telemetryEnabled ? &m_telemetry : nullptr; }
+
 	/// @returns the offset of the entry point of the given function into the list of assembly items
 	/// or zero if it is not found or does not exist.
 	size_t functionEntryPoint(
@@ -489,6 +518,8 @@ private:
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateEvmBytecode = true;
 	bool m_generateIR = false;
+	bool m_telemetryEnabled = false;
+	std::vector<util::PhaseMeasurement> m_telemetry;
 	std::map<std::string, util::h160> m_libraries;
 	ImportRemapper m_importRemapper;
 	std::map<std::string const, Source> m_sources;
@@ -112,6 +112,7 @@ struct OptimiserSettings
 		return
 			runOrderLiterals == _other.runOrderLiterals &&
 			runInliner == _other.runInliner &&
+			shareModifierCode == _other.shareModifierCode &&
 			runJumpdestRemover == _other.runJumpdestRemover &&
 			runPeephole == _other.runPeephole &&
 			runDeduplicate == _other.runDeduplicate &&
@@ -128,6 +129,9 @@ struct OptimiserSettings
 	bool runOrderLiterals = false;
 	/// Inliner
 	bool runInliner = false;
+	/// Compile the code of suitable modifiers once and call it from every function using them
+	/// instead of inlining it into each of them. Only used by the legacy code generator.
+	bool shareModifierCode = false;
 	/// Non-referenced jump destination remover.
 	bool runJumpdestRemover = false;
 	/// Peephole optimizer
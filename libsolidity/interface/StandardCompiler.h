@@ -88,6 +88,7 @@ private:
 		Json::Value outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		bool telemetry = false;
 	};
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
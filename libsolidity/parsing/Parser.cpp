@@ -2183,9 +2183,10 @@ std::optional<std::string> Parser::findLicenseString(std::vector<ASTPointer<ASTN
 
 	// Search inside all parts of the source not covered by parsed nodes.
 	// This will leave e.g. "global comments".
-	using iter = std::string::const_iterator;
+	using iter = std::string_view::const_iterator;
+	using regexIterator = std::regex_iterator<iter>;
 	std::vector<std::pair<iter, iter>> sequencesToSearch;
-	std::string const& source = m_scanner->charStream().source();
+	std::string_view source = m_scanner->charStream().source();
 	sequencesToSearch.emplace_back(source.begin(), source.end());
 	for (ASTPointer<ASTNode> const& node: _nodes)
 		if (node->location().hasText())
@@ -2197,10 +2198,10 @@ std::optional<std::string> Parser::findLicenseString(std::vector<ASTPointer<ASTN
 	std::vector<std::string> licenseNames;
 	for (auto const& [start, end]: sequencesToSearch)
 	{
-		auto declarationsBegin = std::sregex_iterator(start, end, licenseDeclarationRegex);
-		auto declarationsEnd = std::sregex_iterator();
+		auto declarationsBegin = regexIterator(start, end, licenseDeclarationRegex);
+		auto declarationsEnd = regexIterator();
 
-		for (std::sregex_iterator declIt = declarationsBegin; declIt != declarationsEnd; ++declIt)
+		for (regexIterator declIt = declarationsBegin; declIt != declarationsEnd; ++declIt)
 			if (!declIt->empty())
 			{
 				std::string license = boost::trim_copy(std::string((*declIt)[1]));
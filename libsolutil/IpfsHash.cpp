@@ -136,6 +136,48 @@ Chunks buildNextLevel(Chunks& _currentLevel)
 	return nextLevel;
 }
 
+/// Computes the leaf node of a chunk of file data. The node is the protobuf encoding of
+///   PBNode{Data: UnixFS{Type: File, Data: _chunk, filesize: size(_chunk)}}
+/// and is hashed piecewise: the prefix, the chunk data in place and the suffix.
+Chunk hashDataChunk(std::string_view _chunk)
+{
+	bytes lengthAsVarint = varintEncoding(_chunk.size());
+
+	// UnixFS message. Type: File, Data (length delimited bytes, omitted if empty)
+	bytes unixFSPrefix{0x08, 0x02};
+	if (!_chunk.empty())
+		unixFSPrefix += bytes{0x12} + lengthAsVarint;
+	// filesize: length as varint
+	bytes const suffix = bytes{0x18} + lengthAsVarint;
+	size_t unixFSSize = unixFSPrefix.size() + _chunk.size() + suffix.size();
+
+	// PBDag:
+	// Data: (length delimited bytes)
+	bytes const prefix = bytes{0x0a} + varintEncoding(unixFSSize) + unixFSPrefix;
+
+	// Multihash: sha2-256, 256 bits
+	picosha2::hash256_one_by_one hasher;
+	hasher.process(prefix.begin(), prefix.end());
+	// Feed the data in small pieces, so that the hasher does not buffer the whole chunk.
+	size_t const pieceSize = 4096;
+	for (size_t offset = 0; offset < _chunk.size(); offset += pieceSize)
+	{
+		std::string_view piece = _chunk.substr(offset, pieceSize);
+		hasher.process(
+			reinterpret_cast<uint8_t const*>(piece.data()),
+			reinterpret_cast<uint8_t const*>(piece.data()) + piece.size()
+		);
+	}
+	hasher.process(suffix.begin(), suffix.end());
+	hasher.finish();
+
+	bytes hash{0x12, 0x20};
+	hash.resize(2 + picosha2::k_digest_size);
+	hasher.get_hash_bytes(hash.begin() + 2, hash.end());
+
+	return Chunk{std::move(hash), _chunk.size(), prefix.size() + _chunk.size() + suffix.size()};
+}
+
 /// Builds a tree starting from the bottom level where nodes are data nodes.
 /// Data nodes should be calculated and passed as the only level in chunk levels
 /// Each next level is calculated as following:
@@ -152,7 +194,7 @@ bytes groupChunksBottomUp(Chunks _currentLevel)
 }
 }
 
-bytes solidity::util::ipfsHash(std::string _data)
+bytes solidity::util::ipfsHash(std::string_view _data)
 {
 	size_t const maxChunkSize = 1024 * 256;
 	size_t chunkCount = _data.length() / maxChunkSize + (_data.length() % maxChunkSize > 0 ? 1 : 0);
@@ -161,42 +203,12 @@ bytes solidity::util::ipfsHash(std::string _data)
 	Chunks allChunks;
 
 	for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
-	{
-		bytes chunkBytes = asBytes(
-			_data.substr(chunkIndex * maxChunkSize, std::min(maxChunkSize, _data.length() - chunkIndex * maxChunkSize))
-		);
-
-		bytes lengthAsVarint = varintEncoding(chunkBytes.size());
-
-		bytes protobufEncodedData;
-		// Type: File
-		protobufEncodedData += bytes{0x08, 0x02};
-		if (!chunkBytes.empty())
-		{
-			// Data (length delimited bytes)
-			protobufEncodedData += bytes{0x12};
-			protobufEncodedData += lengthAsVarint;
-			protobufEncodedData += chunkBytes;
-		}
-		// filesize: length as varint
-		protobufEncodedData += bytes{0x18} + lengthAsVarint;
-
-		// PBDag:
-		// Data: (length delimited bytes)
-		bytes blockData = encodeByteArray(protobufEncodedData);
-
-		// Multihash: sha2-256, 256 bits
-		allChunks.emplace_back(
-			encodeHash(blockData),
-			chunkBytes.size(),
-			blockData.size()
-		);
-	}
+		allChunks.emplace_back(hashDataChunk(_data.substr(chunkIndex * maxChunkSize, maxChunkSize)));
 
 	return groupChunksBottomUp(std::move(allChunks));
 }
 
-std::string solidity::util::ipfsHashBase58(std::string _data)
+std::string solidity::util::ipfsHashBase58(std::string_view _data)
 {
-	return base58Encode(ipfsHash(std::move(_data)));
+	return base58Encode(ipfsHash(_data));
 }
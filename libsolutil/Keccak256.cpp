@@ -31,28 +31,8 @@ namespace solidity::util
 namespace
 {
 
-/** libkeccak-tiny
- *
- * A single-file implementation of SHA-3 and SHAKE.
- *
- * Implementor: David Leon Gil
- * License: CC0, attribution kindly requested. Blame taken too,
- * but not liability.
- */
-
 /******** The Keccak-f[1600] permutation ********/
 
-/*** Constants. ***/
-static uint8_t const rho[24] = \
-	{ 1,  3,   6, 10, 15, 21,
-	28, 36, 45, 55,  2, 14,
-	27, 41, 56,  8, 25, 43,
-	62, 18, 39, 61, 20, 44};
-static uint8_t const pi[24] = \
-	{10,  7, 11, 17, 18, 3,
-	5, 16,  8, 21, 24, 4,
-	15, 23, 19, 13, 12, 2,
-	20, 14, 22,  9, 6,  1};
 static uint64_t const RC[24] = \
 	{1ULL, 0x8082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
 	0x808bULL, 0x80000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
@@ -61,123 +41,159 @@ static uint64_t const RC[24] = \
 	0x8000000000008002ULL, 0x8000000000000080ULL, 0x800aULL, 0x800000008000000aULL,
 	0x8000000080008081ULL, 0x8000000000008080ULL, 0x80000001ULL, 0x8000000080008008ULL};
 
-/*** Helper macros to unroll the permutation. ***/
-#define rol(x, s) (((x) << s) | ((x) >> (64 - s)))
-#define REPEAT6(e) e e e e e e
-#define REPEAT24(e) REPEAT6(e e e e)
-#define REPEAT5(e) e e e e e
-#define FOR5(type, v, s, e) \
-	v = 0;            \
-	REPEAT5(e; v = static_cast<type>(v + s);)
-
-/*** Keccak-f[1600] ***/
-static inline void keccakf(void* state) {
-	auto* a = static_cast<uint64_t*>(state);
-	uint64_t b[5] = {0};
-
-	for (int i = 0; i < 24; i++)
-	{
-		uint8_t x, y;
-		// Theta
-		FOR5(uint8_t, x, 1,
-			b[x] = 0;
-			FOR5(uint8_t, y, 5,
-				b[x] ^= a[x + y]; ))
-		FOR5(uint8_t, x, 1,
-			FOR5(uint8_t, y, 5,
-				a[y + x] ^= b[(x + 4) % 5] ^ rol(b[(x + 1) % 5], 1); ))
-		// Rho and pi
-		uint64_t t = a[1];
-		x = 0;
-		REPEAT24(b[0] = a[pi[x]];
-				a[pi[x]] = rol(t, rho[x]);
-				t = b[0];
-				x++; )
-		// Chi
-		FOR5(uint8_t,
-			y,
-			5,
-			FOR5(uint8_t, x, 1,
-				b[x] = a[y + x];)
-			FOR5(uint8_t, x, 1,
-				a[y + x] = b[x] ^ ((~b[(x + 1) % 5]) & b[(x + 2) % 5]); ))
-		// Iota
-		a[0] ^= RC[i];
-	}
+/// Number of bytes absorbed per permutation: 200 - (256 / 4).
+size_t constexpr rate = 136;
+size_t constexpr rateInLanes = rate / 8;
+
+inline uint64_t rotl(uint64_t _x, unsigned _s)
+{
+	return (_x << _s) | (_x >> (64 - _s));
 }
 
-/******** The FIPS202-defined functions. ********/
+/// Keccak-f[1600] on a state of 25 lanes, with the rounds unrolled over named lanes
+/// so that the state stays in registers.
+void keccakf(uint64_t* _state)
+{
+	uint64_t a00 = _state[0], a01 = _state[1], a02 = _state[2], a03 = _state[3], a04 = _state[4];
+	uint64_t a05 = _state[5], a06 = _state[6], a07 = _state[7], a08 = _state[8], a09 = _state[9];
+	uint64_t a10 = _state[10], a11 = _state[11], a12 = _state[12], a13 = _state[13], a14 = _state[14];
+	uint64_t a15 = _state[15], a16 = _state[16], a17 = _state[17], a18 = _state[18], a19 = _state[19];
+	uint64_t a20 = _state[20], a21 = _state[21], a22 = _state[22], a23 = _state[23], a24 = _state[24];
 
-/*** Some helper macros. ***/
+	// Lane complementing: keeping the lanes 1, 2, 8, 12, 17 and 20 complemented across
+	// rounds reduces the number of NOT operations in chi from 25 to 8 per round.
+	a01 = ~a01; a02 = ~a02; a08 = ~a08; a12 = ~a12; a17 = ~a17; a20 = ~a20;
 
-#define _(S) do { S } while (0)
-#define FOR(i, ST, L, S) \
-	_(for (size_t i = 0; i < L; i += ST) { S; })
-#define mkapply_ds(NAME, S)                                          \
-	static inline void NAME(uint8_t* dst,                              \
-							uint8_t const* src,                        \
-							size_t len) {                              \
-		FOR(i, 1, len, S);                                               \
-	}
-#define mkapply_sd(NAME, S)                                          \
-	static inline void NAME(uint8_t const* src,                        \
-							uint8_t* dst,                              \
-							size_t len) {                              \
-		FOR(i, 1, len, S);                                               \
+	for (size_t round = 0; round < 24; ++round)
+	{
+		// Theta
+		uint64_t const c0 = a00 ^ a05 ^ a10 ^ a15 ^ a20;
+		uint64_t const c1 = a01 ^ a06 ^ a11 ^ a16 ^ a21;
+		uint64_t const c2 = a02 ^ a07 ^ a12 ^ a17 ^ a22;
+		uint64_t const c3 = a03 ^ a08 ^ a13 ^ a18 ^ a23;
+		uint64_t const c4 = a04 ^ a09 ^ a14 ^ a19 ^ a24;
+		uint64_t const d0 = c4 ^ rotl(c1, 1);
+		uint64_t const d1 = c0 ^ rotl(c2, 1);
+		uint64_t const d2 = c1 ^ rotl(c3, 1);
+		uint64_t const d3 = c2 ^ rotl(c4, 1);
+		uint64_t const d4 = c3 ^ rotl(c0, 1);
+		// Rho and pi
+		uint64_t const b00 = a00 ^ d0;
+		uint64_t const b10 = rotl(a01 ^ d1, 1);
+		uint64_t const b20 = rotl(a02 ^ d2, 62);
+		uint64_t const b05 = rotl(a03 ^ d3, 28);
+		uint64_t const b15 = rotl(a04 ^ d4, 27);
+		uint64_t const b16 = rotl(a05 ^ d0, 36);
+		uint64_t const b01 = rotl(a06 ^ d1, 44);
+		uint64_t const b11 = rotl(a07 ^ d2, 6);
+		uint64_t const b21 = rotl(a08 ^ d3, 55);
+		uint64_t const b06 = rotl(a09 ^ d4, 20);
+		uint64_t const b07 = rotl(a10 ^ d0, 3);
+		uint64_t const b17 = rotl(a11 ^ d1, 10);
+		uint64_t const b02 = rotl(a12 ^ d2, 43);
+		uint64_t const b12 = rotl(a13 ^ d3, 25);
+		uint64_t const b22 = rotl(a14 ^ d4, 39);
+		uint64_t const b23 = rotl(a15 ^ d0, 41);
+		uint64_t const b08 = rotl(a16 ^ d1, 45);
+		uint64_t const b18 = rotl(a17 ^ d2, 15);
+		uint64_t const b03 = rotl(a18 ^ d3, 21);
+		uint64_t const b13 = rotl(a19 ^ d4, 8);
+		uint64_t const b14 = rotl(a20 ^ d0, 18);
+		uint64_t const b24 = rotl(a21 ^ d1, 2);
+		uint64_t const b09 = rotl(a22 ^ d2, 61);
+		uint64_t const b19 = rotl(a23 ^ d3, 56);
+		uint64_t const b04 = rotl(a24 ^ d4, 14);
+		// Chi, on the complemented lanes
+		a00 = b00 ^ (b01 | b02);
+		a01 = b01 ^ (~b02 | b03);
+		a02 = b02 ^ (b03 & b04);
+		a03 = b03 ^ (b04 | b00);
+		a04 = b04 ^ (b00 & b01);
+		a05 = b05 ^ (b06 | b07);
+		a06 = b06 ^ (b07 & b08);
+		a07 = b07 ^ (b08 | ~b09);
+		a08 = b08 ^ (b09 | b05);
+		a09 = b09 ^ (b05 & b06);
+		a10 = b10 ^ (b11 | b12);
+		a11 = b11 ^ (b12 & b13);
+		a12 = b12 ^ (~b13 & b14);
+		a13 = ~b13 ^ (b14 | b10);
+		a14 = b14 ^ (b10 & b11);
+		a15 = b15 ^ (b16 & b17);
+		a16 = b16 ^ (b17 | b18);
+		a17 = b17 ^ (~b18 | b19);
+		a18 = ~b18 ^ (b19 & b15);
+		a19 = b19 ^ (b15 | b16);
+		a20 = b20 ^ (~b21 & b22);
+		a21 = ~b21 ^ (b22 | b23);
+		a22 = b22 ^ (b23 & b24);
+		a23 = b23 ^ (b24 | b20);
+		a24 = b24 ^ (b20 & b21);
+		// Iota
+		a00 ^= RC[round];
 	}
 
-mkapply_ds(xorin, dst[i] ^= src[i])  // xorin
-mkapply_sd(setout, dst[i] = src[i])  // setout
-
-#define P keccakf
-#define Plen 200
+	a01 = ~a01; a02 = ~a02; a08 = ~a08; a12 = ~a12; a17 = ~a17; a20 = ~a20;
+	_state[0] = a00; _state[1] = a01; _state[2] = a02; _state[3] = a03; _state[4] = a04;
+	_state[5] = a05; _state[6] = a06; _state[7] = a07; _state[8] = a08; _state[9] = a09;
+	_state[10] = a10; _state[11] = a11; _state[12] = a12; _state[13] = a13; _state[14] = a14;
+	_state[15] = a15; _state[16] = a16; _state[17] = a17; _state[18] = a18; _state[19] = a19;
+	_state[20] = a20; _state[21] = a21; _state[22] = a22; _state[23] = a23; _state[24] = a24;
+}
 
-// Fold P*F over the full blocks of an input.
-#define foldP(I, L, F) \
-	while (L >= rate) {  \
-		F(a, I, rate);     \
-		P(a);              \
-		I += rate;         \
-		L -= rate;         \
-	}
+/// @returns the @a _index-th little-endian 64 bit word of @a _data.
+inline uint64_t loadLane(uint8_t const* _data, size_t _index)
+{
+	uint64_t lane = 0;
+	std::memcpy(&lane, _data + 8 * _index, 8);
+	return lane;
+}
 
-/** The sponge-based hash construction. **/
-inline void hash(
-	uint8_t* out,
-	size_t outlen,
-	uint8_t const* in,
-	size_t inlen,
-	size_t rate,
-	uint8_t delim
-)
+/// XORs the last, partial block of an input of @a _length bytes into @a _state
+/// and applies the Keccak padding (0x01 ... 0x80).
+inline void absorbLastBlock(uint64_t* _state, uint8_t const* _input, size_t _length)
 {
-	uint8_t a[Plen] = {0};
-	// Absorb input.
-	foldP(in, inlen, xorin);
-	// Xor in the DS and pad frame.
-	a[inlen] ^= delim;
-	a[rate - 1] ^= 0x80;
-	// Xor in the last block.
-	xorin(a, in, inlen);
-	// Apply P
-	P(a);
-	// Squeeze output.
-	foldP(out, outlen, setout);
-	setout(a, out, outlen);
-	memset(a, 0, 200);
+	size_t remaining = _length % rate;
+	uint8_t const* data = _input + (_length - remaining);
+	size_t fullLanes = remaining / 8;
+	for (size_t i = 0; i < fullLanes; ++i)
+		_state[i] ^= loadLane(data, i);
+	uint64_t tail = 0;
+	if (remaining % 8 > 0)
+		std::memcpy(&tail, data + 8 * fullLanes, remaining % 8);
+	_state[fullLanes] ^= tail ^ (uint64_t(0x01) << (8 * (remaining % 8)));
+	_state[rateInLanes - 1] ^= uint64_t(0x80) << 56;
 }
 
 }
 
 h256 keccak256(bytesConstRef _input)
 {
+	uint64_t state[25] = {0};
+	uint8_t const* data = _input.data();
+	size_t fullBlocks = _input.size() / rate;
+	for (size_t block = 0; block < fullBlocks; ++block)
+	{
+		for (size_t i = 0; i < rateInLanes; ++i)
+			state[i] ^= loadLane(data + block * rate, i);
+		keccakf(state);
+	}
+
+	absorbLastBlock(state, data, _input.size());
+	keccakf(state);
+
 	h256 output;
-	// Parameters used:
-	// The 0x01 is the specific padding for keccak (sha3 uses 0x06) and
-	// the way the round size (or window or whatever it was) is calculated.
-	// 200 - (256 / 4) is the "rate"
-	hash(output.data(), output.size, _input.data(), _input.size(), 200 - (256 / 4), 0x01);
+	std::memcpy(output.data(), state, h256::size);
 	return output;
 }
 
+std::vector<h256> keccak256Batch(std::vector<bytesConstRef> const& _inputs)
+{
+	std::vector<h256> outputs;
+	outputs.reserve(_inputs.size());
+	for (bytesConstRef input: _inputs)
+		outputs.emplace_back(keccak256(input));
+	return outputs;
+}
+
 }
@@ -23,25 +23,31 @@
 namespace solidity::util
 {
 
-inline bytes lebEncode(uint64_t _n)
+/// Appends the unsigned LEB128 encoding of @a _n to @a _output.
+inline void lebEncode(uint64_t _n, bytes& _output)
 {
-	bytes encoded;
 	while (_n > 0x7f)
 	{
-		encoded.emplace_back(uint8_t(0x80 | (_n & 0x7f)));
+		_output.emplace_back(uint8_t(0x80 | (_n & 0x7f)));
 		_n >>= 7;
 	}
-	encoded.emplace_back(_n);
+	_output.emplace_back(_n);
+}
+
+inline bytes lebEncode(uint64_t _n)
+{
+	bytes encoded;
+	lebEncode(_n, encoded);
 	return encoded;
 }
 
 // signed right shift is an arithmetic right shift
 static_assert((-1 >> 1) == -1, "Arithmetic shift not supported.");
 
-inline bytes lebEncodeSigned(int64_t _n)
+/// Appends the signed LEB128 encoding of @a _n to @a _output.
+inline void lebEncodeSigned(int64_t _n, bytes& _output)
 {
 	// Based on https://github.com/llvm/llvm-project/blob/master/llvm/include/llvm/Support/LEB128.h
-	bytes result;
 	bool more;
 	do
 	{
@@ -50,9 +56,15 @@ inline bytes lebEncodeSigned(int64_t _n)
 		more = !((((_n == 0) && ((v & 0x40) == 0)) || ((_n == -1) && ((v & 0x40) != 0))));
 		if (more)
 			v |= 0x80; // Mark this byte to show that more bytes will follow.
-		result.emplace_back(v);
+		_output.emplace_back(v);
 	}
 	while (more);
+}
+
+inline bytes lebEncodeSigned(int64_t _n)
+{
+	bytes result;
+	lebEncodeSigned(_n, result);
 	return result;
 }
 
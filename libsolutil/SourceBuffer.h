@@ -0,0 +1,51 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Immutable, shareable storage for the text of a source unit.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace solidity::util
+{
+
+/**
+ * Read-only text of a source unit that can be shared between the components that need it
+ * (the character streams of the scanner and the metadata hashing) without copying.
+ */
+class SourceBuffer
+{
+public:
+	explicit SourceBuffer(std::string _content): m_content(std::move(_content)) {}
+
+	SourceBuffer(SourceBuffer const&) = delete;
+	SourceBuffer& operator=(SourceBuffer const&) = delete;
+
+	std::string_view view() const noexcept { return m_content; }
+	size_t size() const noexcept { return m_content.size(); }
+
+private:
+	std::string m_content;
+};
+
+}
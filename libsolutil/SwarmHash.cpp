@@ -76,11 +76,13 @@ h256 bmtHash(bytesConstRef _data)
 
 h256 chunkHash(bytesConstRef const _data, bool _forceHigherLevel = false)
 {
+	// Full data chunks are hashed in place.
+	if (_data.size() == 0x1000 && !_forceHigherLevel)
+		return keccak256(toLittleEndian(_data.size()) + bmtHash(_data).asBytes());
+
 	bytes dataToHash;
 	if (_data.size() < 0x1000)
 		dataToHash = _data.toBytes();
-	else if (_data.size() == 0x1000 && !_forceHigherLevel)
-		dataToHash = _data.toBytes();
 	else
 	{
 		size_t maxRepresentedSize = 0x1000;
@@ -109,9 +111,9 @@ h256 solidity::util::bzzr0Hash(std::string const& _input)
 }
 
 
-h256 solidity::util::bzzr1Hash(bytes const& _input)
+h256 solidity::util::bzzr1Hash(bytesConstRef _input)
 {
 	if (_input.empty())
 		return h256{};
-	return chunkHash(&_input);
+	return chunkHash(_input);
 }
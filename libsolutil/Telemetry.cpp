@@ -0,0 +1,124 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Telemetry.h>
+
+#include <atomic>
+#include <utility>
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#define SOLIDITY_TELEMETRY_RUSAGE 1
+#include <sys/resource.h>
+#endif
+
+using namespace solidity::util;
+
+namespace
+{
+
+// Both are constant-initialized, so that allocations made during static initialization
+// of other translation units are counted safely. The counter is thread-local, so that counting
+// an allocation is a plain increment without contention between threads. Phases are always
+// measured on the thread that runs them.
+thread_local uint64_t t_allocationCount = 0;
+std::atomic<bool> g_countingAllocations{false};
+
+}
+
+void solidity::util::enableAllocationCounting() noexcept
+{
+	g_countingAllocations.store(true, std::memory_order_relaxed);
+}
+
+void solidity::util::recordAllocation() noexcept
+{
+	++t_allocationCount;
+}
+
+std::optional<uint64_t> solidity::util::allocationCount() noexcept
+{
+	if (!g_countingAllocations.load(std::memory_order_relaxed))
+		return std::nullopt;
+	return t_allocationCount;
+}
+
+std::optional<uint64_t> solidity::util::peakResidentSetSize() noexcept
+{
+#ifdef SOLIDITY_TELEMETRY_RUSAGE
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return std::nullopt;
+#if defined(__APPLE__)
+	// Reported in bytes on macOS...
+	return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+	// ...and in kilobytes elsewhere.
+	return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+	return std::nullopt;
+#endif
+}
+
+Json::Value PhaseMeasurement::toJson() const
+{
+	Json::Value result{Json::objectValue};
+	result["phase"] = phase;
+	if (!contract.empty())
+		result["contract"] = contract;
+	result["wallTimeMicroseconds"] = Json::Int64(wallTime.count());
+	if (allocations)
+		result["allocations"] = Json::UInt64(*allocations);
+	if (peakResidentSetGrowth)
+		result["peakResidentSetGrowthBytes"] = Json::UInt64(*peakResidentSetGrowth);
+	return result;
+}
+
+ScopedPhaseMeasurement::ScopedPhaseMeasurement(
+	std::vector<PhaseMeasurement>* _log,
+	std::string_view _phase,
+	std::string_view _contract
+):
+	m_log(_log)
+{
+	if (!m_log)
+		return;
+	m_phase = _phase;
+	m_contract = _contract;
+	m_allocationsAtStart = allocationCount();
+	m_peakResidentSetAtStart = peakResidentSetSize();
+	// Read the clock last so that the measurement itself is not included in the wall time.
+	m_start = std::chrono::steady_clock::now();
+}
+
+ScopedPhaseMeasurement::~ScopedPhaseMeasurement()
+{
+	if (!m_log)
+		return;
+	auto const wallTime = std::chrono::steady_clock::now() - m_start;
+
+	PhaseMeasurement measurement;
+	measurement.phase = std::move(m_phase);
+	measurement.contract = std::move(m_contract);
+	measurement.wallTime = std::chrono::duration_cast<std::chrono::microseconds>(wallTime);
+	if (std::optional<uint64_t> allocations = allocationCount(); allocations && m_allocationsAtStart)
+		measurement.allocations = *allocations - *m_allocationsAtStart;
+	if (std::optional<uint64_t> peak = peakResidentSetSize(); peak && m_peakResidentSetAtStart)
+		measurement.peakResidentSetGrowth = *peak - *m_peakResidentSetAtStart;
+	m_log->emplace_back(std::move(measurement));
+}
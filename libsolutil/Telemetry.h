@@ -0,0 +1,91 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Measurement of wall time and memory usage of compiler phases.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace solidity::util
+{
+
+/// Declares that the hosting executable replaced the global allocation functions and calls
+/// recordAllocation() from them. Libraries never do, so allocation counts are unavailable
+/// unless the executable opts in.
+void enableAllocationCounting() noexcept;
+
+/// Increments the heap allocation counter of the calling thread.
+/// Called on every allocation, so it only touches thread-local state.
+void recordAllocation() noexcept;
+
+/// @returns the number of heap allocations recorded so far on the calling thread or an empty
+/// optional if allocations are not being counted in this process.
+std::optional<uint64_t> allocationCount() noexcept;
+
+/// @returns the peak resident set size of the process in bytes or an empty optional if the
+/// platform does not provide it.
+std::optional<uint64_t> peakResidentSetSize() noexcept;
+
+/// Resource usage of a single compiler phase.
+struct PhaseMeasurement
+{
+	/// Name of the phase. Sub-phases are separated from their parent phase by a slash.
+	std::string phase;
+	/// Fully qualified name of the contract the phase was run for or empty for phases running
+	/// on all sources.
+	std::string contract;
+	std::chrono::microseconds wallTime{0};
+	std::optional<uint64_t> allocations;
+	/// Growth of the peak resident set size of the process during the phase in bytes.
+	std::optional<uint64_t> peakResidentSetGrowth;
+
+	Json::Value toJson() const;
+};
+
+/**
+ * Measures the resource usage between its construction and destruction and appends it to a log.
+ * Does nothing if the log is null, which makes it cheap to leave in place when telemetry is disabled.
+ */
+class ScopedPhaseMeasurement
+{
+public:
+	ScopedPhaseMeasurement(std::vector<PhaseMeasurement>* _log, std::string_view _phase, std::string_view _contract = {});
+	~ScopedPhaseMeasurement();
+
+	ScopedPhaseMeasurement(ScopedPhaseMeasurement const&) = delete;
+	ScopedPhaseMeasurement& operator=(ScopedPhaseMeasurement const&) = delete;
+
+private:
+	std::vector<PhaseMeasurement>* m_log = nullptr;
+	std::string m_phase;
+	std::string m_contract;
+	std::chrono::steady_clock::time_point m_start;
+	std::optional<uint64_t> m_allocationsAtStart;
+	std::optional<uint64_t> m_peakResidentSetAtStart;
+};
+
+}
@@ -67,6 +67,8 @@ public:
 		return Handle{id, h};
 	}
 	std::string const& idToString(size_t _id) const	{ return *m_strings.at(_id); }
+	/// @returns the number of strings in the repository.
+	size_t size() const { return m_strings.size(); }
 
 	static std::uint64_t hash(std::string const& v)
 	{
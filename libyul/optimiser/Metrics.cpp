@@ -132,6 +132,13 @@ size_t CodeCost::codeCost(Dialect const& _dialect, Expression const& _expr)
 	return cc.m_cost;
 }
 
+size_t CodeCost::codeCost(Dialect const& _dialect, Block const& _block)
+{
+	CodeCost cc(_dialect);
+	cc(_block);
+	return cc.m_cost;
+}
+
 
 void CodeCost::operator()(FunctionCall const& _funCall)
 {
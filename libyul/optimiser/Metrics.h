@@ -114,10 +114,13 @@ class CodeCost: public ASTWalker
 {
 public:
 	static size_t codeCost(Dialect const& _dialect, Expression const& _expression);
+	/// @returns the cost of all statements in the block, including function definitions.
+	static size_t codeCost(Dialect const& _dialect, Block const& _block);
 
 private:
 	CodeCost(Dialect const& _dialect): m_dialect(_dialect) {}
 
+	using ASTWalker::operator();
 	void operator()(FunctionCall const& _funCall) override;
 	void operator()(Literal const& _literal) override;
 	void visit(Statement const& _statement) override;
@@ -491,6 +491,8 @@ void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block&
 		steady_clock::time_point endTime = steady_clock::now();
 		m_durationPerStepInMicroseconds[step] += duration_cast<microseconds>(endTime - startTime).count();
 #endif
+		if (m_stepObserver)
+			m_stepObserver(step, _ast);
 		if (m_debug == Debug::PrintChanges)
 		{
 			// TODO should add switch to also compare variable names!
@@ -27,6 +27,7 @@
 #include <libyul/optimiser/NameDispenser.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <functional>
 #include <set>
 #include <string>
 #include <string_view>
@@ -80,6 +81,10 @@ public:
 	void runSequence(std::vector<std::string> const& _steps, Block& _ast);
 	void runSequence(std::string_view _stepAbbreviations, Block& _ast, bool _repeatUntilStable = false);
 
+	/// Function called by runSequence() after every step with the name of the step and the resulting code.
+	using StepObserver = std::function<void(std::string const& _step, Block const& _ast)>;
+	void setStepObserver(StepObserver _observer) { m_stepObserver = std::move(_observer); }
+
 	static std::map<std::string, std::unique_ptr<OptimiserStep>> const& allSteps();
 	static std::map<std::string, char> const& stepNameToAbbreviationMap();
 	static std::map<char, std::string> const& stepAbbreviationToNameMap();
@@ -87,6 +92,7 @@ public:
 private:
 	OptimiserStepContext& m_context;
 	Debug m_debug;
+	StepObserver m_stepObserver;
 #ifdef PROFILE_OPTIMIZER_STEPS
 	std::map<std::string, int64_t> m_durationPerStepInMicroseconds;
 #endif
@@ -361,6 +361,20 @@ void CommandLineInterface::handleABI(std::string const& _contract)
 		sout() << "Contract JSON ABI" << std::endl << data << std::endl;
 }
 
+void CommandLineInterface::handleTelemetry()
+{
+	solAssert(CompilerInputModes.count(m_options.input.mode) == 1);
+
+	if (!m_options.output.telemetry)
+		return;
+
+	std::string data = jsonPrint(m_compiler->telemetryJson(), m_options.formatting.json);
+	if (!m_options.output.dir.empty())
+		createFile("telemetry.json", data);
+	else
+		sout() << std::endl << "Compiler telemetry:" << std::endl << data << std::endl;
+}
+
 void CommandLineInterface::handleStorageLayout(std::string const& _contract)
 {
 	solAssert(CompilerInputModes.count(m_options.input.mode) == 1);
@@ -736,6 +750,7 @@ void CommandLineInterface::compile()
 		m_compiler->setRemappings(m_options.input.remappings);
 		m_compiler->setLibraries(m_options.linker.libraries);
 		m_compiler->setViaIR(m_options.output.viaIR);
+		m_compiler->enableTelemetry(m_options.output.telemetry);
 		m_compiler->setEVMVersion(m_options.output.evmVersion);
 		m_compiler->setEOFVersion(m_options.output.eofVersion);
 		m_compiler->setRevertStringBehaviour(m_options.output.revertStrings);
@@ -1209,6 +1224,8 @@ void CommandLineInterface::outputCompilationResults()
 		} // end of contracts iteration
 	}
 
+	handleTelemetry();
+
 	if (!m_hasOutput)
 	{
 		if (!m_options.output.dir.empty())
@@ -46,6 +46,7 @@ static std::string const g_strEVM = "evm";
 static std::string const g_strEVMVersion = "evm-version";
 static std::string const g_strEOFVersion = "experimental-eof-version";
 static std::string const g_strViaIR = "via-ir";
+static std::string const g_strTimePasses = "time-passes";
 static std::string const g_strExperimentalViaIR = "experimental-via-ir";
 static std::string const g_strGas = "gas";
 static std::string const g_strHelp = "help";
@@ -85,6 +86,7 @@ static std::string const g_strYulOptimizations = "yul-optimizations";
 static std::string const g_strOutputDir = "output-dir";
 static std::string const g_strOverwrite = "overwrite";
 static std::string const g_strRevertStrings = "revert-strings";
+static std::string const g_strShareModifierCode = "share-modifier-code";
 static std::string const g_strStopAfter = "stop-after";
 static std::string const g_strParsing = "parsing";
 
@@ -232,6 +234,7 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		output.debugInfoSelection == _other.output.debugInfoSelection &&
 		output.stopAfter == _other.output.stopAfter &&
 		output.eofVersion == _other.output.eofVersion &&
+		output.telemetry == _other.output.telemetry &&
 		input.mode == _other.input.mode &&
 		assembly.targetMachine == _other.assembly.targetMachine &&
 		assembly.inputLanguage == _other.assembly.inputLanguage &&
@@ -249,6 +252,7 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		optimizer.optimizeYul == _other.optimizer.optimizeYul &&
 		optimizer.expectedExecutionsPerDeployment == _other.optimizer.expectedExecutionsPerDeployment &&
 		optimizer.yulSteps == _other.optimizer.yulSteps &&
+		optimizer.shareModifierCode == _other.optimizer.shareModifierCode &&
 		modelChecker.initialize == _other.modelChecker.initialize &&
 		modelChecker.settings == _other.modelChecker.settings;
 }
@@ -271,6 +275,8 @@ OptimiserSettings CommandLineOptions::optimiserSettings() const
 	if (optimizer.expectedExecutionsPerDeployment.has_value())
 		settings.expectedExecutionsPerDeployment = optimizer.expectedExecutionsPerDeployment.value();
 
+	settings.shareModifierCode = optimizer.shareModifierCode;
+
 	if (optimizer.yulSteps.has_value())
 	{
 		std::string const fullSequence = optimizer.yulSteps.value();
@@ -624,6 +630,11 @@ General Information)").c_str(),
 			po::value<std::string>()->value_name("stage"),
 			"Stop execution after the given compiler stage. Valid options: \"parsing\"."
 		)
+		(
+			g_strTimePasses.c_str(),
+			"Report wall time, number of heap allocations and growth of peak memory usage "
+			"of each compiler phase and contract as JSON."
+		)
 	;
 	desc.add(outputOptions);
 
@@ -800,6 +811,11 @@ General Information)").c_str(),
 			po::value<std::string>()->value_name("steps"),
 			"Forces Yul optimizer to use the specified sequence of optimization steps instead of the built-in one."
 		)
+		(
+			g_strShareModifierCode.c_str(),
+			"Compile the code of suitable modifiers once and call it from all functions using them "
+			"instead of inlining it into each of them. Only affects the legacy code generator."
+		)
 	;
 	desc.add(optimizerOptions);
 
@@ -957,6 +973,7 @@ void CommandLineParser::processArgs()
 		// TODO: This should eventually contain all options.
 		{g_strExperimentalViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strTimePasses, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strMetadataLiteral, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strNoCBORMetadata, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strMetadataHash, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
@@ -1014,7 +1031,7 @@ void CommandLineParser::processArgs()
 				"Option --" + g_strOptimizeRuns + " is only valid in compiler and assembler modes."
 			);
 
-		for (std::string const& option: {g_strOptimize, g_strNoOptimizeYul, g_strOptimizeYul, g_strYulOptimizations})
+		for (std::string const& option: {g_strOptimize, g_strNoOptimizeYul, g_strOptimizeYul, g_strYulOptimizations, g_strShareModifierCode})
 			if (m_args.count(option) > 0)
 				solThrow(
 					CommandLineValidationError,
@@ -1160,6 +1177,7 @@ void CommandLineParser::processArgs()
 	);
 	if (!m_args[g_strOptimizeRuns].defaulted())
 		m_options.optimizer.expectedExecutionsPerDeployment = m_args.at(g_strOptimizeRuns).as<unsigned>();
+	m_options.optimizer.shareModifierCode = (m_args.count(g_strShareModifierCode) > 0);
 
 	if (m_args.count(g_strYulOptimizations))
 	{
@@ -1361,6 +1379,7 @@ void CommandLineParser::processArgs()
 		m_args.count(g_strModelCheckerTargets) ||
 		m_args.count(g_strModelCheckerTimeout);
 	m_options.output.viaIR = (m_args.count(g_strExperimentalViaIR) > 0 || m_args.count(g_strViaIR) > 0);
+	m_options.output.telemetry = (m_args.count(g_strTimePasses) > 0);
 
 	solAssert(m_options.input.mode == InputMode::Compiler || m_options.input.mode == InputMode::CompilerWithASTImport);
 }
@@ -186,6 +186,7 @@ struct CommandLineOptions
 		std::optional<langutil::DebugInfoSelection> debugInfoSelection;
 		CompilerStack::State stopAfter = CompilerStack::State::CompilationSuccessful;
 		std::optional<uint8_t> eofVersion;
+		bool telemetry = false;
 	} output;
 
 	struct
@@ -226,6 +227,7 @@ struct CommandLineOptions
 		bool optimizeYul = false;
 		std::optional<unsigned> expectedExecutionsPerDeployment;
 		std::optional<std::string> yulSteps;
+		bool shareModifierCode = false;
 	} optimizer;
 
 	struct
@@ -25,15 +25,49 @@
 
 #include <liblangutil/Exceptions.h>
 
+#include <libsolutil/Telemetry.h>
+
 #include <boost/exception/all.hpp>
 
+#include <cstdlib>
 #include <iostream>
+#include <new>
 
 using namespace solidity;
 
+// Replacements of the global allocation functions that count allocations for --time-passes and
+// settings.telemetry. The array and nothrow forms are implemented in terms of these by default.
+void* operator new(std::size_t _size)
+{
+	util::recordAllocation();
+	if (_size == 0)
+		_size = 1;
+	// Like the default implementation, give the installed new-handler a chance to free
+	// memory before failing.
+	while (true)
+	{
+		if (void* memory = std::malloc(_size))
+			return memory;
+		std::new_handler handler = std::get_new_handler();
+		if (!handler)
+			throw std::bad_alloc();
+		handler();
+	}
+}
+
+void operator delete(void* _memory) noexcept
+{
+	std::free(_memory);
+}
+
+void operator delete(void* _memory, std::size_t) noexcept
+{
+	std::free(_memory);
+}
 
 int main(int argc, char** argv)
 {
+	util::enableAllocationCounting();
 	try
 	{
 		solidity::frontend::CommandLineInterface cli(std::cin, std::cout, std::cerr);
@@ -60,6 +60,8 @@ struct CommonOptions
 	bool useABIEncoderV1 = false;
 	bool showMessages = false;
 	bool showMetadata = false;
+	/// Directory of the on-disk cache of compiled semantic test contracts. Disabled if empty.
+	boost::filesystem::path bytecodeCache;
 	size_t batches = 1;
 	size_t selectedBatch = 0;
 
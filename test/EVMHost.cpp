@@ -29,6 +29,7 @@
 #include <libsolutil/Exceptions.h>
 #include <libsolutil/Assertions.h>
 #include <libsolutil/Keccak256.h>
+#include <libsolutil/Visitor.h>
 #include <libsolutil/picosha2.h>
 
 using namespace std;
@@ -145,6 +146,7 @@ EVMHost::EVMHost(langutil::EVMVersion _evmVersion, evmc::VM& _vm):
 void EVMHost::reset()
 {
 	accounts.clear();
+	m_journal.clear();
 	// Clear self destruct records
 	recorded_selfdestructs.clear();
 	// Clear call records
@@ -174,30 +176,97 @@ void EVMHost::newTransactionFrame()
 	// Clear EIP-2929 account access indicator
 	recorded_account_accesses.clear();
 
-	for (auto& [address, account]: accounts)
-		for (auto& [slot, value]: account.storage)
-		{
-			value.access_status = EVMC_ACCESS_COLD; // Clear EIP-2929 storage access indicator
-			value.original = value.current;			// Clear EIP-2200 dirty slot
-		}
+	// Only slots that have been changed since the last frame can be warm or dirty.
+	for (JournalEntry const& entry: m_journal)
+		if (auto const* change = get_if<StorageChanged>(&entry))
+			if (auto account = accounts.find(change->address); account != accounts.end())
+				if (auto value = account->second.storage.find(change->key); value != account->second.storage.end())
+				{
+					value->second.access_status = EVMC_ACCESS_COLD; // Clear EIP-2929 storage access indicator
+					value->second.original = value->second.current;	// Clear EIP-2200 dirty slot
+				}
+	m_journal.clear();
+
 	// Process selfdestruct list
 	for (auto& [address, _]: recorded_selfdestructs)
 		accounts.erase(address);
 	recorded_selfdestructs.clear();
 }
 
-void EVMHost::transfer(evmc::MockedAccount& _sender, evmc::MockedAccount& _recipient, u256 const& _value) noexcept
+void EVMHost::revertToSnapshot(size_t _snapshot)
+{
+	assertThrow(_snapshot <= m_journal.size(), Exception, "Snapshot has already been reverted or committed.");
+	while (m_journal.size() > _snapshot)
+	{
+		std::visit(GenericVisitor{
+			[&](AccountCreated const& _entry) { accounts.erase(_entry.address); },
+			[&](BalanceChanged const& _entry) { accounts.at(_entry.address).balance = _entry.previous; },
+			[&](NonceChanged const& _entry) { accounts.at(_entry.address).nonce = _entry.previous; },
+			[&](CodeChanged& _entry) {
+				evmc::MockedAccount& account = accounts.at(_entry.address);
+				account.code = std::move(_entry.previousCode);
+				account.codehash = _entry.previousCodeHash;
+			},
+			[&](StorageChanged const& _entry) {
+				auto& storage = accounts.at(_entry.address).storage;
+				if (_entry.previous)
+					storage[_entry.key] = *_entry.previous;
+				else
+					storage.erase(_entry.key);
+			}
+		}, m_journal.back());
+		m_journal.pop_back();
+	}
+}
+
+evmc::MockedAccount& EVMHost::journaledAccount(evmc::address const& _addr)
+{
+	auto [account, inserted] = accounts.try_emplace(_addr);
+	if (inserted)
+		m_journal.emplace_back(AccountCreated{_addr});
+	return account->second;
+}
+
+evmc_storage_status EVMHost::set_storage(
+	evmc::address const& _addr,
+	evmc::bytes32 const& _key,
+	evmc::bytes32 const& _value
+) noexcept
+{
+	auto& storage = journaledAccount(_addr).storage;
+	if (auto slot = storage.find(_key); slot == storage.end())
+		m_journal.emplace_back(StorageChanged{_addr, _key, nullopt});
+	else if (slot->second.current != _value)
+		m_journal.emplace_back(StorageChanged{_addr, _key, slot->second});
+	return MockedHost::set_storage(_addr, _key, _value);
+}
+
+evmc_access_status EVMHost::access_storage(evmc::address const& _addr, evmc::bytes32 const& _key) noexcept
+{
+	auto& storage = journaledAccount(_addr).storage;
+	if (auto slot = storage.find(_key); slot == storage.end())
+		m_journal.emplace_back(StorageChanged{_addr, _key, nullopt});
+	else if (slot->second.access_status == EVMC_ACCESS_COLD)
+		m_journal.emplace_back(StorageChanged{_addr, _key, slot->second});
+	return MockedHost::access_storage(_addr, _key);
+}
+
+void EVMHost::transfer(evmc::address const& _sender, evmc::address const& _recipient, u256 const& _value) noexcept
 {
-	assertThrow(u256(convertFromEVMC(_sender.balance)) >= _value, Exception, "Insufficient balance for transfer");
-	_sender.balance = convertToEVMC(u256(convertFromEVMC(_sender.balance)) - _value);
-	_recipient.balance = convertToEVMC(u256(convertFromEVMC(_recipient.balance)) + _value);
+	evmc::MockedAccount& sender = journaledAccount(_sender);
+	evmc::MockedAccount& recipient = journaledAccount(_recipient);
+	assertThrow(u256(convertFromEVMC(sender.balance)) >= _value, Exception, "Insufficient balance for transfer");
+	m_journal.emplace_back(BalanceChanged{_sender, sender.balance});
+	sender.balance = convertToEVMC(u256(convertFromEVMC(sender.balance)) - _value);
+	m_journal.emplace_back(BalanceChanged{_recipient, recipient.balance});
+	recipient.balance = convertToEVMC(u256(convertFromEVMC(recipient.balance)) + _value);
 }
 
 bool EVMHost::selfdestruct(const evmc::address& _addr, const evmc::address& _beneficiary) noexcept
 {
 	// TODO actual selfdestruct is even more complicated.
 
-	transfer(accounts[_addr], accounts[_beneficiary], convertFromEVMC(accounts[_addr].balance));
+	transfer(_addr, _beneficiary, convertFromEVMC(journaledAccount(_addr).balance));
 
 	// Record self destructs. Clearing will be done in newTransactionFrame().
 	return MockedHost::selfdestruct(_addr, _beneficiary);
@@ -248,12 +317,12 @@ evmc::Result EVMHost::call(evmc_message const& _message) noexcept
 	else if (_message.recipient == 0x0000000000000000000000000000000000000009_address && m_evmVersion >= langutil::EVMVersion::istanbul())
 		return precompileBlake2f(_message);
 
-	auto const stateBackup = accounts;
+	size_t const stateSnapshot = snapshot();
 
 	u256 value{convertFromEVMC(_message.value)};
-	auto& sender = accounts[_message.sender];
+	evmc::MockedAccount& sender = journaledAccount(_message.sender);
 
-	evmc::bytes code;
+	evmc::bytes_view code;
 
 	evmc_message message = _message;
 	if (message.depth == 0)
@@ -265,7 +334,7 @@ evmc::Result EVMHost::call(evmc_message const& _message) noexcept
 		{
 			evmc::Result result;
 			result.status_code = EVMC_OUT_OF_GAS;
-			accounts = stateBackup;
+			revertToSnapshot(stateSnapshot);
 			return result;
 		}
 	}
@@ -275,6 +344,7 @@ evmc::Result EVMHost::call(evmc_message const& _message) noexcept
 		// TODO is the nonce incremented on failure, too?
 		// NOTE: nonce for creation from contracts starts at 1
 		// TODO: check if sender is an EOA and do not pre-increment
+		m_journal.emplace_back(NonceChanged{_message.sender, sender.nonce});
 		sender.nonce++;
 
 		auto encodeRlpInteger = [](int value) -> bytes {
@@ -303,7 +373,7 @@ evmc::Result EVMHost::call(evmc_message const& _message) noexcept
 		message.recipient = convertToEVMC(createAddress);
 		assertThrow(accounts.count(message.recipient) == 0, Exception, "Account cannot exist");
 
-		code = evmc::bytes(message.input_data, message.input_data + message.input_size);
+		code = evmc::bytes_view(message.input_data, message.input_size);
 	}
 	else if (message.kind == EVMC_CREATE2)
 	{
@@ -322,16 +392,17 @@ evmc::Result EVMHost::call(evmc_message const& _message) noexcept
 		{
 			evmc::Result result;
 			result.status_code = EVMC_OUT_OF_GAS;
-			accounts = stateBackup;
+			revertToSnapshot(stateSnapshot);
 			return result;
 		}
 
-		code = evmc::bytes(message.input_data, message.input_data + message.input_size);
+		code = evmc::bytes_view(message.input_data, message.input_size);
 	}
 	else
-		code = accounts[message.code_address].code;
+		// Code is only ever set on newly created accounts, so it stays valid during execution.
+		code = journaledAccount(message.code_address).code;
 
-	auto& destination = accounts[message.recipient];
+	evmc::MockedAccount& destination = journaledAccount(message.recipient);
 
 	if (value != 0 && message.kind != EVMC_DELEGATECALL && message.kind != EVMC_CALLCODE)
 	{
@@ -339,10 +410,10 @@ evmc::Result EVMHost::call(evmc_message const& _message) noexcept
 		{
 			evmc::Result result;
 			result.status_code = EVMC_INSUFFICIENT_BALANCE;
-			accounts = stateBackup;
+			revertToSnapshot(stateSnapshot);
 			return result;
 		}
-		transfer(sender, destination, value);
+		transfer(message.sender, message.recipient, value);
 	}
 
 	// Populate the access access list (enabled since Berlin).
@@ -377,13 +448,14 @@ evmc::Result EVMHost::call(evmc_message const& _message) noexcept
 		else
 		{
 			result.create_address = message.recipient;
+			m_journal.emplace_back(CodeChanged{message.recipient, std::move(destination.code), destination.codehash});
 			destination.code = evmc::bytes(result.output_data, result.output_data + result.output_size);
 			destination.codehash = convertToEVMC(keccak256({result.output_data, result.output_size}));
 		}
 	}
 
 	if (result.status_code != EVMC_SUCCESS)
-		accounts = stateBackup;
+		revertToSnapshot(stateSnapshot);
 
 	return result;
 }
@@ -32,6 +32,9 @@
 
 #include <boost/filesystem.hpp>
 
+#include <optional>
+#include <variant>
+
 namespace solidity::test
 {
 using Address = util::h160;
@@ -48,7 +51,6 @@ public:
 	// Verbatim features of MockedHost.
 	using MockedHost::account_exists;
 	using MockedHost::get_storage;
-	using MockedHost::set_storage;
 	using MockedHost::get_balance;
 	using MockedHost::get_code_size;
 	using MockedHost::get_code_hash;
@@ -56,9 +58,14 @@ public:
 	using MockedHost::get_tx_context;
 	using MockedHost::emit_log;
 	using MockedHost::access_account;
-	using MockedHost::access_storage;
 
 	// Modified features of MockedHost.
+	evmc_storage_status set_storage(
+		evmc::address const& _addr,
+		evmc::bytes32 const& _key,
+		evmc::bytes32 const& _value
+	) noexcept final;
+	evmc_access_status access_storage(evmc::address const& _addr, evmc::bytes32 const& _key) noexcept final;
 	bool selfdestruct(evmc::address const& _addr, evmc::address const& _beneficiary) noexcept final;
 	evmc::Result call(evmc_message const& _message) noexcept final;
 	evmc::bytes32 get_block_hash(int64_t number) const noexcept final;
@@ -81,14 +88,22 @@ public:
 	void reset();
 
 	/// Start new block.
+	/// Commits the changes of the current block, which invalidates all snapshots.
 	void newBlock()
 	{
+		newTransactionFrame();
 		tx_context.block_number++;
 		tx_context.block_timestamp += 15;
 		recorded_logs.clear();
-		newTransactionFrame();
 	}
 
+	/// @returns a snapshot of the account state that can later be restored using revertToSnapshot().
+	/// Only changes made through the EVMC host interface and by call() are tracked,
+	/// direct modifications of accounts are not.
+	size_t snapshot() const { return m_journal.size(); }
+	/// Undoes all state changes made since @a _snapshot was taken.
+	void revertToSnapshot(size_t _snapshot);
+
 	/// @returns contents of storage at @param _addr.
 	StorageMap const& get_address_storage(evmc::address const& _addr);
 
@@ -97,12 +112,46 @@ public:
 	static util::h256 convertFromEVMC(evmc::bytes32 const& _data);
 	static evmc::bytes32 convertToEVMC(util::h256 const& _data);
 private:
+	struct AccountCreated
+	{
+		evmc::address address;
+	};
+	struct BalanceChanged
+	{
+		evmc::address address;
+		evmc::uint256be previous;
+	};
+	struct NonceChanged
+	{
+		evmc::address address;
+		int previous;
+	};
+	struct CodeChanged
+	{
+		evmc::address address;
+		evmc::bytes previousCode;
+		evmc::bytes32 previousCodeHash;
+	};
+	struct StorageChanged
+	{
+		evmc::address address;
+		evmc::bytes32 key;
+		/// Not set if the slot did not exist before.
+		std::optional<evmc::StorageValue> previous;
+	};
+	/// Records the previous value of a piece of account state before it is modified.
+	using JournalEntry = std::variant<AccountCreated, BalanceChanged, NonceChanged, CodeChanged, StorageChanged>;
+
+	/// @returns the account at @a _addr, creating it (and journaling its creation) if it does not exist.
+	evmc::MockedAccount& journaledAccount(evmc::address const& _addr);
+
 	/// Transfer value between accounts. Checks for sufficient balance.
-	void transfer(evmc::MockedAccount& _sender, evmc::MockedAccount& _recipient, u256 const& _value) noexcept;
+	void transfer(evmc::address const& _sender, evmc::address const& _recipient, u256 const& _value) noexcept;
 
 	/// Start a new transaction frame.
-	/// This will perform selfdestructs, apply storage status changes across all accounts,
-	/// and clear account/storage access indicator for EIP-2929.
+	/// This will perform selfdestructs, apply storage status changes to the slots modified since the
+	/// last frame, clear account/storage access indicator for EIP-2929
+	/// and clear the journal.
 	void newTransactionFrame();
 
 	/// Records calls made via @param _message.
@@ -132,6 +181,8 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	/// EVM version requested from EVMC (matches the above)
 	evmc_revision m_evmRevision;
+	/// Changes to the account state since the last transaction frame, in the order they were made.
+	std::vector<JournalEntry> m_journal;
 };
 
 class EVMHostPrinter
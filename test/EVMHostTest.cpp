@@ -0,0 +1,135 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the snapshots of the account state of EVMHost.
+ */
+
+#include <test/EVMHost.h>
+
+#include <libsolutil/Exceptions.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace evmc::literals;
+
+namespace solidity::test
+{
+
+namespace
+{
+
+evmc::address const c_account = 0x1111111111111111111111111111111111111111_address;
+evmc::bytes32 const c_slot = 0x01_bytes32;
+
+evmc::bytes32 storageValue(EVMHost const& _host, evmc::bytes32 const& _key)
+{
+	return _host.get_storage(c_account, _key);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(EVMHostTest)
+
+BOOST_AUTO_TEST_CASE(revert_storage_change)
+{
+	evmc::VM vm;
+	EVMHost host(langutil::EVMVersion{}, vm);
+	host.set_storage(c_account, c_slot, 0x2a_bytes32);
+
+	size_t snapshot = host.snapshot();
+	host.set_storage(c_account, c_slot, 0x2b_bytes32);
+	BOOST_CHECK(storageValue(host, c_slot) == 0x2b_bytes32);
+
+	host.revertToSnapshot(snapshot);
+	BOOST_CHECK(storageValue(host, c_slot) == 0x2a_bytes32);
+}
+
+BOOST_AUTO_TEST_CASE(revert_account_creation)
+{
+	evmc::VM vm;
+	EVMHost host(langutil::EVMVersion{}, vm);
+
+	size_t snapshot = host.snapshot();
+	host.set_storage(c_account, c_slot, 0x2a_bytes32);
+	BOOST_CHECK(host.account_exists(c_account));
+
+	host.revertToSnapshot(snapshot);
+	BOOST_CHECK(!host.account_exists(c_account));
+}
+
+BOOST_AUTO_TEST_CASE(revert_storage_access)
+{
+	evmc::VM vm;
+	EVMHost host(langutil::EVMVersion{}, vm);
+	host.set_storage(c_account, c_slot, 0x2a_bytes32);
+	host.newBlock();
+
+	size_t snapshot = host.snapshot();
+	BOOST_CHECK(host.access_storage(c_account, c_slot) == EVMC_ACCESS_COLD);
+	BOOST_CHECK(host.access_storage(c_account, c_slot) == EVMC_ACCESS_WARM);
+
+	host.revertToSnapshot(snapshot);
+	BOOST_CHECK(host.access_storage(c_account, c_slot) == EVMC_ACCESS_COLD);
+}
+
+BOOST_AUTO_TEST_CASE(nested_snapshots)
+{
+	evmc::VM vm;
+	EVMHost host(langutil::EVMVersion{}, vm);
+	evmc::bytes32 const otherSlot = 0x02_bytes32;
+	host.set_storage(c_account, c_slot, 0x01_bytes32);
+
+	size_t outer = host.snapshot();
+	host.set_storage(c_account, c_slot, 0x02_bytes32);
+
+	size_t inner = host.snapshot();
+	host.set_storage(c_account, c_slot, 0x03_bytes32);
+	host.set_storage(c_account, otherSlot, 0x04_bytes32);
+
+	host.revertToSnapshot(inner);
+	BOOST_CHECK(storageValue(host, c_slot) == 0x02_bytes32);
+	BOOST_CHECK(host.accounts.at(c_account).storage.count(otherSlot) == 0);
+
+	// Changes made after reverting the inner snapshot are undone by the outer one.
+	host.set_storage(c_account, otherSlot, 0x05_bytes32);
+	host.revertToSnapshot(outer);
+	BOOST_CHECK(storageValue(host, c_slot) == 0x01_bytes32);
+	BOOST_CHECK(host.accounts.at(c_account).storage.count(otherSlot) == 0);
+
+	// The inner snapshot has been reverted as part of the outer one.
+	BOOST_CHECK_THROW(host.revertToSnapshot(inner), util::Exception);
+}
+
+BOOST_AUTO_TEST_CASE(new_block_invalidates_snapshots)
+{
+	evmc::VM vm;
+	EVMHost host(langutil::EVMVersion{}, vm);
+
+	size_t snapshot = host.snapshot();
+	host.set_storage(c_account, c_slot, 0x2a_bytes32);
+	host.newBlock();
+
+	BOOST_CHECK_THROW(host.revertToSnapshot(snapshot + 1), util::Exception);
+	host.revertToSnapshot(host.snapshot());
+	BOOST_CHECK(storageValue(host, c_slot) == 0x2a_bytes32);
+	BOOST_CHECK(host.accounts.at(c_account).storage.at(c_slot).original == 0x2a_bytes32);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
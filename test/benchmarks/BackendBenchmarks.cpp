@@ -0,0 +1,291 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <test/benchmarks/Benchmarks.h>
+
+#include <libsolidity/codegen/Compiler.h>
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/DebugSettings.h>
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <libyul/Object.h>
+#include <libyul/YulStack.h>
+#include <libyul/backends/evm/ControlFlowGraphBuilder.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/StackLayoutGenerator.h>
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/Disambiguator.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/Suite.h>
+
+#include <libevmasm/Assembly.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+#include <liblangutil/EVMVersion.h>
+
+#include <libsolutil/CommonIO.h>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace solidity;
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+using namespace solidity::yul;
+using namespace solidity::test::benchmarks;
+
+namespace
+{
+
+/// The contract the back end is measured on. It compiles with both pipelines and
+/// does not create other contracts.
+std::string const c_sourceName = "verifier.sol";
+std::string const c_contractName = "verifier.sol:Verifier";
+
+std::shared_ptr<CompilerStack> compileBenchmarkInput(
+	boost::filesystem::path const& _inputDirectory,
+	bool _viaIR,
+	CompilerStack::State _stopAfter
+)
+{
+	auto compiler = std::make_shared<CompilerStack>();
+	compiler->setSources({{c_sourceName, util::readFileAsString(_inputDirectory / c_sourceName)}});
+	compiler->setViaIR(_viaIR);
+	compiler->setOptimiserSettings(OptimiserSettings::standard());
+	bool success = compiler->compile(_stopAfter);
+	solAssert(success, "Benchmark input " + c_sourceName + " failed to compile.");
+	return compiler;
+}
+
+/// @returns the runtime object of the given Yul code of a contract.
+std::shared_ptr<Object> parseRuntimeObject(std::string const& _yul)
+{
+	YulStack stack(
+		EVMVersion{},
+		std::nullopt,
+		YulStack::Language::StrictAssembly,
+		OptimiserSettings::none(),
+		DebugInfoSelection::Default()
+	);
+	bool success = stack.parseAndAnalyze(c_sourceName, _yul);
+	solAssert(success, "Yul code of " + c_contractName + " failed to parse.");
+	std::shared_ptr<Object> runtimeObject;
+	for (auto const& subObject: stack.parserResult()->subObjects)
+		if (auto object = std::dynamic_pointer_cast<Object>(subObject))
+			if (boost::ends_with(object->name.str(), "_deployed"))
+				runtimeObject = object;
+	solAssert(runtimeObject, "Runtime object of " + c_contractName + " not found.");
+	return runtimeObject;
+}
+
+/// Disambiguated runtime code in the form all optimiser steps can be applied to.
+struct OptimiserInput
+{
+	Dialect const& dialect;
+	std::set<YulString> reservedIdentifiers;
+	yul::Block ast;
+};
+
+std::shared_ptr<OptimiserInput const> prepareOptimiserInput(Object const& _runtimeObject)
+{
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVMObjects(EVMVersion{});
+	std::set<YulString> reservedIdentifiers = dialect.fixedFunctionNames();
+	yul::Block ast = std::get<yul::Block>(
+		Disambiguator(dialect, *_runtimeObject.analysisInfo, reservedIdentifiers)(*_runtimeObject.code)
+	);
+	NameDispenser dispenser{dialect, ast, reservedIdentifiers};
+	OptimiserStepContext context{
+		dialect,
+		dispenser,
+		reservedIdentifiers,
+		OptimiserSettings::standard().expectedExecutionsPerDeployment
+	};
+	// Same prefix as in OptimiserSuite::run().
+	OptimiserSuite{context}.runSequence("hgfo", ast);
+	return std::make_shared<OptimiserInput const>(OptimiserInput{dialect, std::move(reservedIdentifiers), std::move(ast)});
+}
+
+Benchmark optimiserStepBenchmark(std::shared_ptr<OptimiserInput const> _input, OptimiserStep const& _step)
+{
+	struct StepInput
+	{
+		yul::Block ast;
+		NameDispenser dispenser;
+	};
+	auto inputs = std::make_shared<std::vector<StepInput>>();
+	OptimiserStep const* step = &_step;
+	Benchmark benchmark{
+		"yulOptimiser/" + _step.name,
+		[=](size_t _iterations) {
+			solAssert(inputs->size() == _iterations);
+			for (StepInput& input: *inputs)
+			{
+				OptimiserStepContext context{
+					_input->dialect,
+					input.dispenser,
+					_input->reservedIdentifiers,
+					OptimiserSettings::standard().expectedExecutionsPerDeployment
+				};
+				step->run(context, input.ast);
+			}
+			doNotOptimize(inputs.get());
+		},
+		0,
+		{}
+	};
+	benchmark.setup = [=](size_t _iterations) {
+		inputs->clear();
+		inputs->reserve(_iterations);
+		for (size_t i = 0; i < _iterations; ++i)
+			inputs->push_back({ASTCopier{}.translate(_input->ast), NameDispenser{_input->dialect, _input->ast, _input->reservedIdentifiers}});
+	};
+	return benchmark;
+}
+
+std::vector<Benchmark> stackLayoutBenchmarks(std::shared_ptr<Object const> _runtimeObject)
+{
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVMObjects(EVMVersion{});
+	std::shared_ptr<CFG const> cfg = ControlFlowGraphBuilder::build(
+		*_runtimeObject->analysisInfo,
+		dialect,
+		*_runtimeObject->code
+	);
+	return {
+		Benchmark{
+			"controlFlowGraphBuilder/" + c_sourceName,
+			[=, &dialect](size_t _iterations) {
+				for (size_t i = 0; i < _iterations; ++i)
+				{
+					std::unique_ptr<CFG> graph = ControlFlowGraphBuilder::build(
+						*_runtimeObject->analysisInfo,
+						dialect,
+						*_runtimeObject->code
+					);
+					doNotOptimize(graph.get());
+				}
+			},
+			0,
+			{}
+		},
+		Benchmark{
+			"stackLayoutGenerator/" + c_sourceName,
+			[=](size_t _iterations) {
+				for (size_t i = 0; i < _iterations; ++i)
+				{
+					StackLayout layout = StackLayoutGenerator::run(*cfg);
+					doNotOptimize(&layout);
+				}
+			},
+			0,
+			{}
+		}
+	};
+}
+
+std::vector<Benchmark> assemblyBenchmarks(std::shared_ptr<CompilerStack const> _analysedCompiler)
+{
+	// Legacy code generation without optimisation, producing an assembly that has
+	// neither been optimised nor assembled yet.
+	auto generate = [=]() {
+		auto compiler = std::make_shared<Compiler>(EVMVersion{}, RevertStrings::Default, OptimiserSettings::none());
+		compiler->compileContract(_analysedCompiler->contractDefinition(c_contractName), {}, {});
+		return compiler;
+	};
+	// Code generation is much more expensive than copying its result, so it is only done once
+	// and the optimiser and the assembler get fresh copies of the generated assembly.
+	std::shared_ptr<evmasm::Assembly const> generated = generate()->assemblyPtr();
+	auto inputs = std::make_shared<std::vector<std::shared_ptr<evmasm::Assembly>>>();
+	auto setup = [=](size_t _iterations) {
+		inputs->clear();
+		for (size_t i = 0; i < _iterations; ++i)
+			inputs->emplace_back(generated->deepCopy());
+	};
+
+	Benchmark optimise{
+		"assembly/optimise/" + c_sourceName,
+		[=](size_t _iterations) {
+			solAssert(inputs->size() == _iterations);
+			auto settings = evmasm::Assembly::OptimiserSettings::translateSettings(OptimiserSettings::standard(), EVMVersion{});
+			for (auto const& assembly: *inputs)
+				assembly->optimise(settings);
+			doNotOptimize(inputs.get());
+		},
+		0,
+		{},
+		setup
+	};
+	Benchmark assemble{
+		"assembly/assemble/" + c_sourceName,
+		[=](size_t _iterations) {
+			solAssert(inputs->size() == _iterations);
+			for (auto const& assembly: *inputs)
+				doNotOptimize(&assembly->assemble());
+		},
+		0,
+		{},
+		setup
+	};
+	return {
+		Benchmark{
+			"assembly/generate/" + c_sourceName,
+			[=](size_t _iterations) {
+				for (size_t i = 0; i < _iterations; ++i)
+					doNotOptimize(generate().get());
+			},
+			0,
+			{}
+		},
+		std::move(optimise),
+		std::move(assemble)
+	};
+}
+
+}
+
+std::vector<Benchmark> solidity::test::benchmarks::backendBenchmarks(boost::filesystem::path const& _inputDirectory)
+{
+	std::vector<Benchmark> benchmarks;
+
+	std::shared_ptr<CompilerStack const> irCompiler = compileBenchmarkInput(
+		_inputDirectory,
+		true,
+		CompilerStack::State::CompilationSuccessful
+	);
+	std::shared_ptr<OptimiserInput const> optimiserInput = prepareOptimiserInput(
+		*parseRuntimeObject(irCompiler->yulIR(c_contractName))
+	);
+	for (auto const& [name, step]: OptimiserSuite::allSteps())
+		if (!step->invalidInCurrentEnvironment())
+			benchmarks.emplace_back(optimiserStepBenchmark(optimiserInput, *step));
+
+	for (Benchmark& benchmark: stackLayoutBenchmarks(parseRuntimeObject(irCompiler->yulIROptimized(c_contractName))))
+		benchmarks.emplace_back(std::move(benchmark));
+
+	std::shared_ptr<CompilerStack const> analysedCompiler = compileBenchmarkInput(
+		_inputDirectory,
+		false,
+		CompilerStack::State::AnalysisSuccessful
+	);
+	for (Benchmark& benchmark: assemblyBenchmarks(analysedCompiler))
+		benchmarks.emplace_back(std::move(benchmark));
+
+	return benchmarks;
+}
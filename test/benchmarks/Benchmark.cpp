@@ -0,0 +1,160 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <test/benchmarks/Benchmark.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace solidity::test::benchmarks;
+
+namespace
+{
+
+void const* volatile g_sink = nullptr;
+
+double medianOf(std::vector<double> _values)
+{
+	if (_values.empty())
+		return 0.0;
+	std::sort(_values.begin(), _values.end());
+	size_t middle = _values.size() / 2;
+	if (_values.size() % 2 == 1)
+		return _values[middle];
+	return (_values[middle - 1] + _values[middle]) / 2.0;
+}
+
+/// @returns the wall time in seconds taken by @a _iterations executions of @a _benchmark,
+/// not counting its setup.
+double timeIterations(Benchmark const& _benchmark, size_t _iterations)
+{
+	if (!_benchmark.setup)
+	{
+		auto start = std::chrono::steady_clock::now();
+		_benchmark.run(_iterations);
+		auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration<double>(end - start).count();
+	}
+
+	solAssert(_benchmark.maxSetupBatch > 0);
+	double seconds = 0.0;
+	for (size_t done = 0; done < _iterations;)
+	{
+		size_t batch = std::min(_iterations - done, _benchmark.maxSetupBatch);
+		_benchmark.setup(batch);
+		auto start = std::chrono::steady_clock::now();
+		_benchmark.run(batch);
+		auto end = std::chrono::steady_clock::now();
+		seconds += std::chrono::duration<double>(end - start).count();
+		done += batch;
+	}
+	return seconds;
+}
+
+}
+
+void solidity::test::benchmarks::doNotOptimize(void const* _pointer)
+{
+	g_sink = _pointer;
+}
+
+double Measurement::median() const
+{
+	return medianOf(samples);
+}
+
+double Measurement::minimum() const
+{
+	return samples.empty() ? 0.0 : *std::min_element(samples.begin(), samples.end());
+}
+
+double Measurement::medianAbsoluteDeviation() const
+{
+	double center = median();
+	std::vector<double> deviations;
+	for (double sample: samples)
+		deviations.push_back(std::abs(sample - center));
+	return medianOf(std::move(deviations));
+}
+
+double Measurement::throughput() const
+{
+	if (unitsPerIteration == 0 || median() <= 0.0)
+		return 0.0;
+	return static_cast<double>(unitsPerIteration) * 1e9 / median();
+}
+
+Json::Value Measurement::toJson() const
+{
+	Json::Value result{Json::objectValue};
+	result["name"] = name;
+	result["iterationsPerSample"] = Json::UInt64(iterationsPerSample);
+	result["medianNs"] = median();
+	result["minimumNs"] = minimum();
+	result["madNs"] = medianAbsoluteDeviation();
+	result["samplesNs"] = Json::arrayValue;
+	for (double sample: samples)
+		result["samplesNs"].append(sample);
+	if (unitsPerIteration > 0)
+	{
+		result["unit"] = unitName;
+		result["unitsPerSecond"] = throughput();
+	}
+	return result;
+}
+
+Measurement BenchmarkRunner::run(Benchmark const& _benchmark) const
+{
+	solAssert(m_samples > 0);
+
+	// Calibrate: double the number of executions until a sample takes long enough.
+	// This also serves as warm-up.
+	size_t iterations = 1;
+	while (timeIterations(_benchmark, iterations) < m_minSampleSeconds && iterations < (size_t(1) << 40))
+		iterations *= 2;
+
+	Measurement measurement;
+	measurement.name = _benchmark.name;
+	measurement.iterationsPerSample = iterations;
+	measurement.unitsPerIteration = _benchmark.unitsPerIteration;
+	measurement.unitName = _benchmark.unitName;
+	for (size_t sample = 0; sample < m_samples; ++sample)
+		measurement.samples.push_back(
+			timeIterations(_benchmark, iterations) * 1e9 / static_cast<double>(iterations)
+		);
+	return measurement;
+}
+
+std::string solidity::test::benchmarks::formatMeasurement(Measurement const& _measurement)
+{
+	double median = _measurement.median();
+	std::string line = fmt::format(
+		"{:<48} {:>14.1f} ns {:>6.1f}% MAD",
+		_measurement.name,
+		median,
+		median > 0.0 ? 100.0 * _measurement.medianAbsoluteDeviation() / median : 0.0
+	);
+	if (_measurement.unitsPerIteration > 0)
+		line += fmt::format(" {:>14.0f} {}/s", _measurement.throughput(), _measurement.unitName);
+	return line;
+}
@@ -0,0 +1,103 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Minimal harness for microbenchmarks of compiler internals.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace solidity::test::benchmarks
+{
+
+/// Prevents the compiler from optimising away the computation of the value at @a _pointer.
+void doNotOptimize(void const* _pointer);
+
+/**
+ * A named operation to be measured.
+ */
+struct Benchmark
+{
+	std::string name;
+	/// Executes the measured operation the given number of times.
+	std::function<void(size_t)> run;
+	/// Number of units (bytes, tokens, nodes, ...) processed by a single execution of the
+	/// operation. Used to report throughput. Zero if throughput is not meaningful.
+	size_t unitsPerIteration = 0;
+	std::string unitName;
+	/// Optional preparation executed before every timed call of ``run`` with the same number of
+	/// iterations. Its duration is not measured. Used to create fresh inputs for operations
+	/// that modify or consume them. Benchmarks with a setup are run in batches of at most
+	/// ``maxSetupBatch`` iterations, so that only a bounded number of inputs exists at a time.
+	std::function<void(size_t)> setup = {};
+	size_t maxSetupBatch = 64;
+};
+
+/**
+ * Result of measuring a benchmark: the time per execution of each sample.
+ */
+struct Measurement
+{
+	std::string name;
+	size_t iterationsPerSample = 0;
+	/// Nanoseconds per single execution, one entry per sample.
+	std::vector<double> samples;
+	size_t unitsPerIteration = 0;
+	std::string unitName;
+
+	double median() const;
+	double minimum() const;
+	/// Median absolute deviation from the median.
+	double medianAbsoluteDeviation() const;
+	/// @returns units per second based on the median, or zero if there are no units.
+	double throughput() const;
+
+	Json::Value toJson() const;
+};
+
+/**
+ * Runs benchmarks with repeated, calibrated samples. The number of executions per sample
+ * is chosen so that every sample takes at least the given minimum time, and a warm-up
+ * sample is discarded. Reporting the median and the median absolute deviation makes the
+ * results robust against outliers caused by other load on the machine.
+ */
+class BenchmarkRunner
+{
+public:
+	BenchmarkRunner(size_t _samples, double _minSampleSeconds):
+		m_samples(_samples),
+		m_minSampleSeconds(_minSampleSeconds)
+	{}
+
+	Measurement run(Benchmark const& _benchmark) const;
+
+private:
+	size_t m_samples;
+	double m_minSampleSeconds;
+};
+
+/// Formats @a _measurement as a human-readable line.
+std::string formatMeasurement(Measurement const& _measurement);
+
+}
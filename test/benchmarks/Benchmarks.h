@@ -0,0 +1,43 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Benchmarks available in solbench, grouped by component.
+ */
+
+#pragma once
+
+#include <test/benchmarks/Benchmark.h>
+
+#include <boost/filesystem/path.hpp>
+
+#include <vector>
+
+namespace solidity::test::benchmarks
+{
+
+/// Keccak-256 on inputs of various sizes, single and batched.
+std::vector<Benchmark> keccakBenchmarks();
+
+/// Scanner, parser and type checker on each of the Solidity sources in @a _inputDirectory.
+std::vector<Benchmark> frontendBenchmarks(boost::filesystem::path const& _inputDirectory);
+
+/// Every Yul optimiser step, control flow graph construction and stack layout generation, as well as
+/// legacy code generation, assembly optimisation and assembling, on a contract from @a _inputDirectory.
+std::vector<Benchmark> backendBenchmarks(boost::filesystem::path const& _inputDirectory);
+
+}
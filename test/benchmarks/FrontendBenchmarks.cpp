@@ -0,0 +1,185 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <test/benchmarks/Benchmarks.h>
+
+#include <libsolidity/analysis/ContractLevelChecker.h>
+#include <libsolidity/analysis/DeclarationTypeChecker.h>
+#include <libsolidity/analysis/DocStringTagParser.h>
+#include <libsolidity/analysis/GlobalContext.h>
+#include <libsolidity/analysis/NameAndTypeResolver.h>
+#include <libsolidity/analysis/Scoper.h>
+#include <libsolidity/analysis/SyntaxChecker.h>
+#include <libsolidity/analysis/TypeChecker.h>
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTVisitor.h>
+#include <libsolidity/parsing/Parser.h>
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/ErrorReporter.h>
+#include <liblangutil/Scanner.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/SourceBuffer.h>
+
+#include <memory>
+#include <string>
+
+using namespace solidity;
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+using namespace solidity::test::benchmarks;
+
+namespace
+{
+
+/// Solidity sources of test/benchmarks, also used by run.sh.
+std::string const c_sourceNames[] = {"chains.sol", "verifier.sol", "OptimizorClub.sol"};
+
+class NodeCounter: public ASTConstVisitor
+{
+public:
+	size_t count = 0;
+
+private:
+	bool visitNode(ASTNode const&) override
+	{
+		++count;
+		return true;
+	}
+};
+
+ASTPointer<SourceUnit> parseSource(std::shared_ptr<util::SourceBuffer const> const& _source, std::string const& _name, ErrorReporter& _errorReporter)
+{
+	CharStream stream(_source, _name);
+	ASTPointer<SourceUnit> ast = Parser{_errorReporter, EVMVersion{}}.parse(stream);
+	solAssert(ast && !_errorReporter.hasErrors(), "Benchmark input " + _name + " failed to parse.");
+	return ast;
+}
+
+Benchmark scannerBenchmark(std::shared_ptr<util::SourceBuffer const> _source, std::string const& _name)
+{
+	auto countTokens = [=]() {
+		CharStream stream(_source, _name);
+		Scanner scanner(stream);
+		size_t tokens = 1;
+		while (scanner.next() != Token::EOS)
+			++tokens;
+		return tokens;
+	};
+	return Benchmark{
+		"scanner/" + _name,
+		[=](size_t _iterations) {
+			for (size_t i = 0; i < _iterations; ++i)
+			{
+				size_t tokens = countTokens();
+				doNotOptimize(&tokens);
+			}
+		},
+		countTokens(),
+		"tokens"
+	};
+}
+
+Benchmark parserBenchmark(std::shared_ptr<util::SourceBuffer const> _source, std::string const& _name)
+{
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	NodeCounter counter;
+	parseSource(_source, _name, errorReporter)->accept(counter);
+	return Benchmark{
+		"parser/" + _name,
+		[=](size_t _iterations) {
+			for (size_t i = 0; i < _iterations; ++i)
+			{
+				ErrorList errors;
+				ErrorReporter errorReporter(errors);
+				ASTPointer<SourceUnit> ast = parseSource(_source, _name, errorReporter);
+				doNotOptimize(ast.get());
+			}
+		},
+		counter.count,
+		"nodes"
+	};
+}
+
+/// A source unit on which all analysis steps that precede the type checker in
+/// CompilerStack::analyze() have been run.
+struct TypeCheckerInput
+{
+	TypeCheckerInput(std::shared_ptr<util::SourceBuffer const> const& _source, std::string const& _name):
+		ast(parseSource(_source, _name, errorReporter))
+	{
+		Scoper::assignScopes(*ast);
+		bool success = SyntaxChecker{errorReporter, false}.checkSyntax(*ast);
+		success = success && resolver.registerDeclarations(*ast);
+		success = success && resolver.performImports(*ast, {{_name, ast.get()}});
+		DocStringTagParser docStringTagParser{errorReporter};
+		success = success && docStringTagParser.parseDocStrings(*ast);
+		success = success && resolver.resolveNamesAndTypes(*ast);
+		success = success && DeclarationTypeChecker{errorReporter, EVMVersion{}}.check(*ast);
+		success = success && docStringTagParser.validateDocStringsUsingTypes(*ast);
+		success = success && ContractLevelChecker{errorReporter}.check(*ast);
+		solAssert(success && !errorReporter.hasErrors(), "Benchmark input " + _name + " failed to analyze.");
+	}
+
+	ErrorList errors;
+	ErrorReporter errorReporter{errors};
+	GlobalContext globalContext;
+	NameAndTypeResolver resolver{globalContext, EVMVersion{}, errorReporter};
+	ASTPointer<SourceUnit> ast;
+};
+
+Benchmark typeCheckerBenchmark(std::shared_ptr<util::SourceBuffer const> _source, std::string const& _name)
+{
+	auto inputs = std::make_shared<std::vector<std::unique_ptr<TypeCheckerInput>>>();
+	Benchmark benchmark{
+		"typeChecker/" + _name,
+		[=](size_t _iterations) {
+			solAssert(inputs->size() == _iterations);
+			for (auto& input: *inputs)
+			{
+				bool success = TypeChecker{EVMVersion{}, input->errorReporter}.checkTypeRequirements(*input->ast);
+				doNotOptimize(&success);
+			}
+		},
+		0,
+		{}
+	};
+	benchmark.setup = [=](size_t _iterations) {
+		inputs->clear();
+		for (size_t i = 0; i < _iterations; ++i)
+			inputs->emplace_back(std::make_unique<TypeCheckerInput>(_source, _name));
+	};
+	return benchmark;
+}
+
+}
+
+std::vector<Benchmark> solidity::test::benchmarks::frontendBenchmarks(boost::filesystem::path const& _inputDirectory)
+{
+	std::vector<Benchmark> benchmarks;
+	for (std::string const& name: c_sourceNames)
+	{
+		auto source = std::make_shared<util::SourceBuffer const>(util::readFileAsString(_inputDirectory / name));
+		benchmarks.emplace_back(scannerBenchmark(source, name));
+		benchmarks.emplace_back(parserBenchmark(source, name));
+		benchmarks.emplace_back(typeCheckerBenchmark(source, name));
+	}
+	return benchmarks;
+}
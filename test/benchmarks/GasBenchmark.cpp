@@ -0,0 +1,266 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <test/benchmarks/GasBenchmark.h>
+
+#include <test/EVMHost.h>
+
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/FunctionSelector.h>
+
+#include <boost/throw_exception.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace solidity;
+using namespace solidity::test;
+using namespace solidity::test::benchmarks;
+
+namespace
+{
+
+/// Gas given to every transaction, same as in ExecutionFramework.
+int64_t const c_transactionGas = 100000000;
+
+struct TransactionResult
+{
+	bool success = false;
+	u256 gasUsed;
+	util::h160 createdAddress;
+	bytes output;
+};
+
+TransactionResult transact(
+	EVMHost& _host,
+	langutil::EVMVersion _evmVersion,
+	util::h160 const& _sender,
+	std::optional<util::h160> const& _recipient,
+	bytes const& _data
+)
+{
+	_host.newBlock();
+
+	evmc_message message{};
+	message.input_data = _data.data();
+	message.input_size = _data.size();
+	message.sender = EVMHost::convertToEVMC(_sender);
+	if (_recipient)
+	{
+		message.kind = EVMC_CALL;
+		message.recipient = EVMHost::convertToEVMC(*_recipient);
+		message.code_address = message.recipient;
+	}
+	else
+		message.kind = EVMC_CREATE;
+	message.gas = c_transactionGas;
+
+	evmc::Result result = _host.call(message);
+
+	// Refunds are applied the same way as in ExecutionFramework::sendMessage().
+	unsigned const refundRatio = (_evmVersion >= langutil::EVMVersion::london() ? 5 : 2);
+	u256 const totalGasUsed = u256(c_transactionGas - result.gas_left);
+	u256 const gasRefund = std::min(u256(result.gas_refund), totalGasUsed / refundRatio);
+
+	TransactionResult transactionResult;
+	transactionResult.success = (result.status_code == EVMC_SUCCESS);
+	transactionResult.gasUsed = totalGasUsed - gasRefund;
+	transactionResult.output = bytes(result.output_data, result.output_data + result.output_size);
+	if (!_recipient)
+		transactionResult.createdAddress = EVMHost::convertFromEVMC(result.create_address);
+	return transactionResult;
+}
+
+}
+
+AbiValue AbiValue::word(u256 const& _value)
+{
+	return AbiValue{false, toBigEndian(_value)};
+}
+
+AbiValue AbiValue::address(util::h160 const& _address)
+{
+	return AbiValue{false, util::h256(_address, util::h256::AlignRight).asBytes()};
+}
+
+AbiValue AbiValue::hash(util::h256 const& _hash)
+{
+	return AbiValue{false, _hash.asBytes()};
+}
+
+AbiValue AbiValue::bytesValue(bytes const& _data)
+{
+	bytes encoding = toBigEndian(u256(_data.size())) + _data;
+	encoding.resize(32 + (_data.size() + 31) / 32 * 32, 0);
+	return AbiValue{true, std::move(encoding)};
+}
+
+AbiValue AbiValue::array(std::vector<AbiValue> _elements)
+{
+	return AbiValue{true, toBigEndian(u256(_elements.size())) + encodeArguments(_elements)};
+}
+
+AbiValue AbiValue::tuple(std::vector<AbiValue> _members)
+{
+	bool dynamic = std::any_of(_members.begin(), _members.end(), [](AbiValue const& _member) { return _member.isDynamic(); });
+	return AbiValue{dynamic, encodeArguments(_members)};
+}
+
+bytes solidity::test::benchmarks::encodeArguments(std::vector<AbiValue> const& _values)
+{
+	size_t headSize = 0;
+	for (AbiValue const& value: _values)
+		headSize += value.isDynamic() ? 32 : value.encoding().size();
+
+	bytes head;
+	bytes tail;
+	for (AbiValue const& value: _values)
+		if (value.isDynamic())
+		{
+			head += toBigEndian(u256(headSize + tail.size()));
+			tail += value.encoding();
+		}
+		else
+			head += value.encoding();
+	return head + tail;
+}
+
+bytes solidity::test::benchmarks::encodeCall(std::string const& _signature, std::vector<AbiValue> const& _arguments)
+{
+	return util::selectorFromSignatureH32(_signature).asBytes() + encodeArguments(_arguments);
+}
+
+util::h160 solidity::test::benchmarks::gasBenchmarkAccount(size_t _index)
+{
+	return util::h160(util::h256(u256{"0x1212121212121212121212121212120000000012"} + _index * 0x1000), util::h160::AlignRight);
+}
+
+GasBenchmarkRunner::GasBenchmarkRunner(
+	evmc::VM& _vm,
+	langutil::EVMVersion _evmVersion,
+	boost::filesystem::path _corpusDirectory
+):
+	m_vm(_vm),
+	m_evmVersion(_evmVersion),
+	m_corpusDirectory(std::move(_corpusDirectory))
+{
+}
+
+std::map<std::string, u256> GasBenchmarkRunner::run(GasScenario const& _scenario, GasConfiguration const& _configuration)
+{
+	frontend::CompilerStack compiler;
+	compiler.setSources({{_scenario.sourceFile, util::readFileAsString(m_corpusDirectory / _scenario.sourceFile)}});
+	compiler.setEVMVersion(m_evmVersion);
+	compiler.setViaIR(_configuration.viaIR);
+	compiler.setOptimiserSettings(
+		_configuration.optimize ?
+		frontend::OptimiserSettings::standard() :
+		frontend::OptimiserSettings::minimal()
+	);
+	// The metadata hash changes with every compiler version and would only add noise.
+	compiler.setMetadataFormat(frontend::CompilerStack::MetadataFormat::NoMetadata);
+	if (!compiler.compile())
+		BOOST_THROW_EXCEPTION(std::runtime_error(
+			"Compiling " + _scenario.sourceFile + " (" + _configuration.name + ") failed:\n" +
+			langutil::SourceReferenceFormatter::formatErrorInformation(compiler.errors(), compiler)
+		));
+
+	std::string const contractName = _scenario.sourceFile + ":" + _scenario.contractName;
+	std::map<std::string, u256> measurements;
+	measurements["codeSize"] = compiler.runtimeObject(contractName).bytecode.size();
+
+	EVMHost host(m_evmVersion, m_vm);
+	host.reset();
+	for (size_t i = 0; i < 10; i++)
+		host.accounts[EVMHost::convertToEVMC(gasBenchmarkAccount(i))].balance = EVMHost::convertToEVMC(u256(1) << 100);
+
+	auto check = [&](TransactionResult const& _result, std::string const& _description) {
+		if (!_result.success)
+			BOOST_THROW_EXCEPTION(std::runtime_error(
+				_scenario.name + " (" + _configuration.name + "): " + _description +
+				" failed with output 0x" + util::toHex(_result.output)
+			));
+	};
+
+	TransactionResult deployment = transact(
+		host,
+		m_evmVersion,
+		gasBenchmarkAccount(0),
+		std::nullopt,
+		compiler.object(contractName).bytecode + encodeArguments(_scenario.constructorArguments)
+	);
+	check(deployment, "deployment");
+	measurements["deployment"] = deployment.gasUsed;
+
+	for (GasCall const& call: _scenario.calls)
+	{
+		TransactionResult result = transact(
+			host,
+			m_evmVersion,
+			gasBenchmarkAccount(call.sender),
+			deployment.createdAddress,
+			encodeCall(call.signature, call.arguments)
+		);
+		check(result, call.signature);
+		if (!call.name.empty())
+			measurements[call.name] = result.gasUsed;
+	}
+	return measurements;
+}
+
+Json::Value solidity::test::benchmarks::diffAgainstBaseline(Json::Value const& _baseline, Json::Value const& _current)
+{
+	Json::Value changed{Json::objectValue};
+	Json::Value added{Json::objectValue};
+	Json::Value removed{Json::objectValue};
+
+	for (std::string const& name: _current.getMemberNames())
+	{
+		if (!_baseline.isMember(name))
+		{
+			added[name] = _current[name];
+			continue;
+		}
+		Json::Int64 const baselineValue = _baseline[name].asInt64();
+		Json::Int64 const currentValue = _current[name].asInt64();
+		if (baselineValue == currentValue)
+			continue;
+		Json::Value change{Json::objectValue};
+		change["baseline"] = baselineValue;
+		change["current"] = currentValue;
+		change["delta"] = currentValue - baselineValue;
+		if (baselineValue != 0)
+			change["relative"] = static_cast<double>(currentValue - baselineValue) / static_cast<double>(baselineValue);
+		changed[name] = std::move(change);
+	}
+	for (std::string const& name: _baseline.getMemberNames())
+		if (!_current.isMember(name))
+			removed[name] = _baseline[name];
+
+	Json::Value diff{Json::objectValue};
+	diff["changed"] = std::move(changed);
+	diff["added"] = std::move(added);
+	diff["removed"] = std::move(removed);
+	return diff;
+}
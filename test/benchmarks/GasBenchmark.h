@@ -0,0 +1,136 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Measurement of the gas consumed by the code the compiler generates for a corpus of contracts.
+ */
+
+#pragma once
+
+#include <test/evmc/evmc.hpp>
+
+#include <liblangutil/EVMVersion.h>
+
+#include <libsolutil/Common.h>
+#include <libsolutil/FixedHash.h>
+
+#include <json/json.h>
+
+#include <boost/filesystem.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace solidity::test::benchmarks
+{
+
+/**
+ * A value passed to a contract, encoded according to the contract ABI.
+ */
+class AbiValue
+{
+public:
+	/// Any static 32-byte value, e.g. an unsigned integer, bool or bytes32.
+	static AbiValue word(u256 const& _value);
+	static AbiValue address(util::h160 const& _address);
+	static AbiValue hash(util::h256 const& _hash);
+	/// Dynamically sized bytes.
+	static AbiValue bytesValue(bytes const& _data);
+	/// Dynamically sized array T[] of the given elements.
+	static AbiValue array(std::vector<AbiValue> _elements);
+	/// Tuple or struct of the given members.
+	static AbiValue tuple(std::vector<AbiValue> _members);
+
+	bool isDynamic() const { return m_dynamic; }
+	/// The head of a static value or the tail of a dynamic one.
+	bytes const& encoding() const { return m_encoding; }
+
+private:
+	AbiValue(bool _dynamic, bytes _encoding): m_dynamic(_dynamic), m_encoding(std::move(_encoding)) {}
+
+	bool m_dynamic = false;
+	bytes m_encoding;
+};
+
+/// @returns the ABI encoding of the given values as a tuple, i.e. the encoding of function arguments.
+bytes encodeArguments(std::vector<AbiValue> const& _values);
+/// @returns the calldata for calling the function with the given signature.
+bytes encodeCall(std::string const& _signature, std::vector<AbiValue> const& _arguments);
+
+/// @returns the address of the i-th externally owned account used in the scenarios.
+util::h160 gasBenchmarkAccount(size_t _index);
+
+/// A transaction sent to the contract under test.
+struct GasCall
+{
+	/// Name under which the gas usage is reported. Calls with an empty name only prepare the state.
+	std::string name;
+	std::string signature;
+	std::vector<AbiValue> arguments;
+	/// Index of the sending account, see gasBenchmarkAccount().
+	size_t sender = 0;
+};
+
+/// A contract of the corpus together with the transactions used to measure it.
+struct GasScenario
+{
+	std::string name;
+	/// Path of the source file relative to the corpus directory.
+	std::string sourceFile;
+	std::string contractName;
+	std::vector<AbiValue> constructorArguments;
+	std::vector<GasCall> calls;
+};
+
+/// Compiler settings the corpus is measured with.
+struct GasConfiguration
+{
+	std::string name;
+	bool viaIR = false;
+	bool optimize = false;
+};
+
+/// @returns the corpus of scenarios.
+std::vector<GasScenario> gasScenarios();
+/// @returns legacy and via-IR code generation, each with and without optimization.
+std::vector<GasConfiguration> gasConfigurations();
+
+/**
+ * Compiles scenarios and executes their transactions on a fresh simulated chain.
+ */
+class GasBenchmarkRunner
+{
+public:
+	GasBenchmarkRunner(evmc::VM& _vm, langutil::EVMVersion _evmVersion, boost::filesystem::path _corpusDirectory);
+
+	/// Runs the scenario and returns the measurements, keyed by "deployment", "codeSize" and the
+	/// names of the measured calls.
+	/// Throws std::runtime_error if compilation fails or a transaction reverts.
+	std::map<std::string, u256> run(GasScenario const& _scenario, GasConfiguration const& _configuration);
+
+private:
+	evmc::VM& m_vm;
+	langutil::EVMVersion m_evmVersion;
+	boost::filesystem::path m_corpusDirectory;
+};
+
+/// @returns an object describing the entries of @a _current that differ from @a _baseline,
+/// as well as the ones present in only one of them. Both map measurement names to numbers.
+Json::Value diffAgainstBaseline(Json::Value const& _baseline, Json::Value const& _current);
+
+}
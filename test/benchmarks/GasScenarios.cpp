@@ -0,0 +1,238 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * The transactions executed against the contracts in test/benchmarks/gas.
+ */
+
+#include <test/benchmarks/GasBenchmark.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/Keccak256.h>
+
+#include <algorithm>
+
+using namespace solidity;
+using namespace solidity::test::benchmarks;
+using namespace solidity::util;
+
+namespace
+{
+
+AbiValue account(size_t _index)
+{
+	return AbiValue::address(gasBenchmarkAccount(_index));
+}
+
+GasScenario erc20()
+{
+	return {
+		"erc20",
+		"ERC20.sol",
+		"ERC20",
+		{AbiValue::word(u256(1) << 128)},
+		{
+			{"transfer", "transfer(address,uint256)", {account(1), AbiValue::word(1000)}, 0},
+			{"transferExisting", "transfer(address,uint256)", {account(1), AbiValue::word(1000)}, 0},
+			{"approve", "approve(address,uint256)", {account(2), AbiValue::word(5000)}, 0},
+			{"transferFrom", "transferFrom(address,address,uint256)", {account(0), account(3), AbiValue::word(2000)}, 2},
+			{"transferByRecipient", "transfer(address,uint256)", {account(4), AbiValue::word(1000)}, 3}
+		}
+	};
+}
+
+GasScenario erc721()
+{
+	return {
+		"erc721",
+		"ERC721.sol",
+		"ERC721",
+		{},
+		{
+			{"mint", "mint(address,uint256)", {account(0), AbiValue::word(1)}, 0},
+			{"", "mint(address,uint256)", {account(0), AbiValue::word(2)}, 0},
+			{"approve", "approve(address,uint256)", {account(1), AbiValue::word(1)}, 0},
+			{"transferFromApproved", "transferFrom(address,address,uint256)", {account(0), account(2), AbiValue::word(1)}, 1},
+			{"setApprovalForAll", "setApprovalForAll(address,bool)", {account(3), AbiValue::word(1)}, 0},
+			{
+				"safeTransferFrom",
+				"safeTransferFrom(address,address,uint256,bytes)",
+				{account(0), account(4), AbiValue::word(2), AbiValue::bytesValue(asBytes("gas benchmark"))},
+				3
+			}
+		}
+	};
+}
+
+GasScenario amm()
+{
+	u256 const liquidity = u256(1) << 80;
+	return {
+		"amm",
+		"AMM.sol",
+		"AMM",
+		{},
+		{
+			{"deposit", "deposit(uint256,uint256)", {AbiValue::word(liquidity), AbiValue::word(liquidity)}, 0},
+			{"addLiquidityInitial", "addLiquidity(uint256,uint256)", {AbiValue::word(liquidity / 2), AbiValue::word(liquidity / 2)}, 0},
+			{"addLiquidity", "addLiquidity(uint256,uint256)", {AbiValue::word(liquidity / 4), AbiValue::word(liquidity / 4)}, 0},
+			{"swap0For1", "swap(bool,uint256,uint256)", {AbiValue::word(1), AbiValue::word(1000000), AbiValue::word(1)}, 0},
+			{"swap1For0", "swap(bool,uint256,uint256)", {AbiValue::word(0), AbiValue::word(1000000), AbiValue::word(1)}, 0},
+			{"removeLiquidity", "removeLiquidity(uint256)", {AbiValue::word(liquidity / 8)}, 0}
+		}
+	};
+}
+
+GasScenario merkleDistributor()
+{
+	size_t const leafCount = 8;
+	u256 const amount = 100;
+
+	std::vector<std::vector<h256>> levels(1);
+	for (size_t i = 0; i < leafCount; i++)
+		levels[0].emplace_back(keccak256(
+			toBigEndian(u256(i)) + gasBenchmarkAccount(i).asBytes() + toBigEndian(amount)
+		));
+	while (levels.back().size() > 1)
+	{
+		std::vector<h256> const& level = levels.back();
+		std::vector<h256> parents;
+		for (size_t i = 0; i < level.size(); i += 2)
+		{
+			auto [first, second] = std::minmax(level[i], level[i + 1]);
+			parents.emplace_back(keccak256(first.asBytes() + second.asBytes()));
+		}
+		levels.emplace_back(std::move(parents));
+	}
+
+	auto proof = [&](size_t _leaf) {
+		std::vector<AbiValue> siblings;
+		for (size_t level = 0; level + 1 < levels.size(); level++, _leaf /= 2)
+			siblings.emplace_back(AbiValue::hash(levels[level][_leaf ^ 1]));
+		return AbiValue::array(std::move(siblings));
+	};
+	auto claim = [&](std::string _name, size_t _leaf) {
+		return GasCall{
+			std::move(_name),
+			"claim(uint256,address,uint256,bytes32[])",
+			{AbiValue::word(_leaf), account(_leaf), AbiValue::word(amount), proof(_leaf)},
+			_leaf
+		};
+	};
+
+	return {
+		"merkleDistributor",
+		"MerkleDistributor.sol",
+		"MerkleDistributor",
+		{AbiValue::hash(levels.back().front())},
+		{
+			claim("claimFirst", 0),
+			claim("claimSameWord", 5),
+			{
+				"verify",
+				"verify(bytes32[],bytes32,bytes32)",
+				{proof(3), AbiValue::hash(levels.back().front()), AbiValue::hash(levels[0][3])},
+				0
+			}
+		}
+	};
+}
+
+GasScenario router()
+{
+	auto hop = [](size_t _pool, size_t _fee, bool _zeroForOne) {
+		return AbiValue::tuple({
+			AbiValue::address(gasBenchmarkAccount(100 + _pool)),
+			AbiValue::word(_fee),
+			AbiValue::word(_zeroForOne ? 1 : 0)
+		});
+	};
+	auto route = [&](size_t _hops, bytes const& _extraData) {
+		std::vector<AbiValue> hops;
+		for (size_t i = 0; i < _hops; i++)
+			hops.emplace_back(hop(i, 500 * (1 + i % 3), i % 2 == 0));
+		return AbiValue::tuple({
+			AbiValue::array(std::move(hops)),
+			AbiValue::word(1000000000),
+			AbiValue::word(1),
+			AbiValue::bytesValue(_extraData)
+		});
+	};
+	std::string const routeType = "((address,uint24,bool)[],uint256,uint256,bytes)";
+
+	std::vector<AbiValue> routes;
+	std::vector<AbiValue> executeCalls;
+	for (size_t i = 1; i <= 4; i++)
+	{
+		routes.emplace_back(route(i, bytes(i * 24, static_cast<uint8_t>(i))));
+		executeCalls.emplace_back(AbiValue::bytesValue(encodeCall("execute(" + routeType + ")", {routes.back()})));
+	}
+
+	return {
+		"router",
+		"Router.sol",
+		"Router",
+		{},
+		{
+			{"quote", "quote(" + routeType + ")", {route(3, {})}, 0},
+			{"quoteAll", "quoteAll(" + routeType + "[])", {AbiValue::array(routes)}, 0},
+			{"executeSingleHop", "execute(" + routeType + ")", {route(1, {})}, 0},
+			{"executeMultiHop", "execute(" + routeType + ")", {route(4, bytes(100, 0xab))}, 0},
+			{"multicall", "multicall(bytes[])", {AbiValue::array(std::move(executeCalls))}, 0}
+		}
+	};
+}
+
+GasScenario historicalReads()
+{
+	GasScenario scenario{"historicalReads", "HistoricalReads.sol", "HistoricalReads", {}, {}};
+	scenario.calls.push_back({"pushFirst", "push(uint192)", {AbiValue::word(1)}, 0});
+	for (size_t i = 2; i <= 32; i++)
+		scenario.calls.push_back({"", "push(uint192)", {AbiValue::word(i)}, 0});
+	// Every transaction is executed in a new block, so the checkpoints lie in consecutive blocks.
+	scenario.calls.push_back({"valueAtRecent", "valueAt(uint256)", {AbiValue::word(30)}, 0});
+	scenario.calls.push_back({"valueAtOld", "valueAt(uint256)", {AbiValue::word(2)}, 0});
+
+	scenario.calls.push_back({"read", "read(address,uint256,uint256)", {account(1), AbiValue::word(0), AbiValue::word(10)}, 0});
+	std::vector<AbiValue> blockNumbers;
+	for (size_t i = 1; i <= 16; i++)
+		blockNumbers.emplace_back(AbiValue::word(i * 2));
+	scenario.calls.push_back({
+		"readRange",
+		"readRange(address,uint256,uint256[])",
+		{account(1), AbiValue::word(0), AbiValue::array(std::move(blockNumbers))},
+		0
+	});
+	return scenario;
+}
+
+}
+
+std::vector<GasScenario> solidity::test::benchmarks::gasScenarios()
+{
+	return {erc20(), erc721(), amm(), merkleDistributor(), router(), historicalReads()};
+}
+
+std::vector<GasConfiguration> solidity::test::benchmarks::gasConfigurations()
+{
+	return {
+		{"legacy", false, false},
+		{"legacy-optimize", false, true},
+		{"via-ir", true, false},
+		{"via-ir-optimize", true, true}
+	};
+}
@@ -0,0 +1,80 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <test/benchmarks/Benchmarks.h>
+
+#include <libsolutil/Keccak256.h>
+
+#include <memory>
+#include <string>
+
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::test::benchmarks;
+
+namespace
+{
+
+Benchmark singleHashBenchmark(size_t _size)
+{
+	auto input = std::make_shared<bytes>(_size, uint8_t(0x42));
+	return Benchmark{
+		"keccak256/" + std::to_string(_size) + "B",
+		[input](size_t _iterations) {
+			for (size_t i = 0; i < _iterations; ++i)
+			{
+				h256 hash = keccak256(*input);
+				doNotOptimize(&hash);
+			}
+		},
+		_size,
+		"bytes"
+	};
+}
+
+}
+
+std::vector<Benchmark> solidity::test::benchmarks::keccakBenchmarks()
+{
+	std::vector<Benchmark> benchmarks;
+	size_t const sizes[] = {32, 64, 135, 136, 1024, 64 * 1024};
+	for (size_t size: sizes)
+		benchmarks.emplace_back(singleHashBenchmark(size));
+
+	// Function signatures, as hashed for selectors and event topics.
+	auto signatures = std::make_shared<std::vector<std::string>>();
+	for (size_t i = 0; i < 1000; ++i)
+		signatures->emplace_back("transferFrom" + std::to_string(i) + "(address,address,uint256)");
+	auto signatureRefs = std::make_shared<std::vector<bytesConstRef>>();
+	for (std::string const& signature: *signatures)
+		signatureRefs->emplace_back(signature);
+
+	benchmarks.emplace_back(Benchmark{
+		"keccak256Batch/1000 signatures",
+		[signatures, signatureRefs](size_t _iterations) {
+			for (size_t i = 0; i < _iterations; ++i)
+			{
+				std::vector<h256> hashes = keccak256Batch(*signatureRefs);
+				doNotOptimize(hashes.data());
+			}
+		},
+		signatureRefs->size(),
+		"hashes"
+	});
+	return benchmarks;
+}
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.8.0;
+
+/// Constant product market maker with internally accounted token balances.
+contract AMM {
+    uint256 public reserve0;
+    uint256 public reserve1;
+    uint256 public totalShares;
+    uint32 public constant feeBasisPoints = 30;
+
+    mapping(address => uint256) public shares;
+    mapping(address => uint256) public balance0;
+    mapping(address => uint256) public balance1;
+
+    event Swap(address indexed trader, bool zeroForOne, uint256 amountIn, uint256 amountOut);
+    event Mint(address indexed provider, uint256 amount0, uint256 amount1, uint256 shares);
+    event Burn(address indexed provider, uint256 amount0, uint256 amount1, uint256 shares);
+
+    function deposit(uint256 amount0, uint256 amount1) external {
+        balance0[msg.sender] += amount0;
+        balance1[msg.sender] += amount1;
+    }
+
+    function addLiquidity(uint256 amount0, uint256 amount1) external returns (uint256 minted) {
+        balance0[msg.sender] -= amount0;
+        balance1[msg.sender] -= amount1;
+        if (totalShares == 0)
+            minted = sqrt(amount0 * amount1);
+        else
+            minted = min(amount0 * totalShares / reserve0, amount1 * totalShares / reserve1);
+        require(minted > 0, "AMM: insufficient liquidity minted");
+        shares[msg.sender] += minted;
+        totalShares += minted;
+        reserve0 += amount0;
+        reserve1 += amount1;
+        emit Mint(msg.sender, amount0, amount1, minted);
+    }
+
+    function removeLiquidity(uint256 burned) external returns (uint256 amount0, uint256 amount1) {
+        amount0 = burned * reserve0 / totalShares;
+        amount1 = burned * reserve1 / totalShares;
+        shares[msg.sender] -= burned;
+        totalShares -= burned;
+        reserve0 -= amount0;
+        reserve1 -= amount1;
+        balance0[msg.sender] += amount0;
+        balance1[msg.sender] += amount1;
+        emit Burn(msg.sender, amount0, amount1, burned);
+    }
+
+    function getAmountOut(uint256 amountIn, uint256 reserveIn, uint256 reserveOut) public pure returns (uint256) {
+        uint256 amountInWithFee = amountIn * (10000 - feeBasisPoints);
+        return amountInWithFee * reserveOut / (reserveIn * 10000 + amountInWithFee);
+    }
+
+    function swap(bool zeroForOne, uint256 amountIn, uint256 minAmountOut) external returns (uint256 amountOut) {
+        if (zeroForOne) {
+            amountOut = getAmountOut(amountIn, reserve0, reserve1);
+            require(amountOut >= minAmountOut, "AMM: slippage");
+            balance0[msg.sender] -= amountIn;
+            balance1[msg.sender] += amountOut;
+            reserve0 += amountIn;
+            reserve1 -= amountOut;
+        } else {
+            amountOut = getAmountOut(amountIn, reserve1, reserve0);
+            require(amountOut >= minAmountOut, "AMM: slippage");
+            balance1[msg.sender] -= amountIn;
+            balance0[msg.sender] += amountOut;
+            reserve1 += amountIn;
+            reserve0 -= amountOut;
+        }
+        emit Swap(msg.sender, zeroForOne, amountIn, amountOut);
+    }
+
+    function min(uint256 a, uint256 b) internal pure returns (uint256) {
+        return a < b ? a : b;
+    }
+
+    function sqrt(uint256 y) internal pure returns (uint256 z) {
+        if (y > 3) {
+            z = y;
+            uint256 x = y / 2 + 1;
+            while (x < z) {
+                z = x;
+                x = (y / x + x) / 2;
+            }
+        } else if (y != 0) {
+            z = 1;
+        }
+    }
+}
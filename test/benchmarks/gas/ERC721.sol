@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.8.0;
+
+interface IERC721Receiver {
+    function onERC721Received(address operator, address from, uint256 tokenId, bytes calldata data) external returns (bytes4);
+}
+
+contract ERC721 {
+    event Transfer(address indexed from, address indexed to, uint256 indexed tokenId);
+    event Approval(address indexed owner, address indexed approved, uint256 indexed tokenId);
+    event ApprovalForAll(address indexed owner, address indexed operator, bool approved);
+
+    mapping(uint256 => address) public ownerOf;
+    mapping(address => uint256) public balanceOf;
+    mapping(uint256 => address) public getApproved;
+    mapping(address => mapping(address => bool)) public isApprovedForAll;
+
+    function mint(address to, uint256 tokenId) external {
+        require(to != address(0), "ERC721: mint to the zero address");
+        require(ownerOf[tokenId] == address(0), "ERC721: token already minted");
+        unchecked { balanceOf[to]++; }
+        ownerOf[tokenId] = to;
+        emit Transfer(address(0), to, tokenId);
+    }
+
+    function approve(address spender, uint256 tokenId) external {
+        address owner = ownerOf[tokenId];
+        require(msg.sender == owner || isApprovedForAll[owner][msg.sender], "ERC721: not authorized");
+        getApproved[tokenId] = spender;
+        emit Approval(owner, spender, tokenId);
+    }
+
+    function setApprovalForAll(address operator, bool approved) external {
+        isApprovedForAll[msg.sender][operator] = approved;
+        emit ApprovalForAll(msg.sender, operator, approved);
+    }
+
+    function transferFrom(address from, address to, uint256 tokenId) public {
+        require(from == ownerOf[tokenId], "ERC721: wrong from");
+        require(to != address(0), "ERC721: transfer to the zero address");
+        require(
+            msg.sender == from || isApprovedForAll[from][msg.sender] || msg.sender == getApproved[tokenId],
+            "ERC721: not authorized"
+        );
+        unchecked {
+            balanceOf[from]--;
+            balanceOf[to]++;
+        }
+        ownerOf[tokenId] = to;
+        delete getApproved[tokenId];
+        emit Transfer(from, to, tokenId);
+    }
+
+    function safeTransferFrom(address from, address to, uint256 tokenId, bytes calldata data) external {
+        transferFrom(from, to, tokenId);
+        require(
+            to.code.length == 0 ||
+            IERC721Receiver(to).onERC721Received(msg.sender, from, tokenId, data) == IERC721Receiver.onERC721Received.selector,
+            "ERC721: unsafe recipient"
+        );
+    }
+}
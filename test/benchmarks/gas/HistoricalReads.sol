@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.8.0;
+
+/// Historical state access: reads through the caerus precompile and binary searched checkpoints.
+contract HistoricalReads {
+    struct Checkpoint {
+        uint64 blockNumber;
+        uint192 value;
+    }
+
+    Checkpoint[] public checkpoints;
+
+    function push(uint192 value) external {
+        checkpoints.push(Checkpoint(uint64(block.number), value));
+    }
+
+    function valueAt(uint256 blockNumber) external view returns (uint192) {
+        uint256 low = 0;
+        uint256 high = checkpoints.length;
+        while (low < high) {
+            uint256 mid = (low + high) / 2;
+            if (checkpoints[mid].blockNumber > blockNumber)
+                high = mid;
+            else
+                low = mid + 1;
+        }
+        return low == 0 ? 0 : checkpoints[low - 1].value;
+    }
+
+    function read(address account, uint256 slot, uint256 blockNumber) external view returns (bytes32) {
+        return caerus(account, slot, blockNumber);
+    }
+
+    function readRange(address account, uint256 slot, uint256[] calldata blockNumbers) external view returns (bytes32 digest) {
+        for (uint256 i = 0; i < blockNumbers.length; i++)
+            digest ^= caerus(account, slot, blockNumbers[i]);
+    }
+}
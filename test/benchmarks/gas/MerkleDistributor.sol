@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.8.0;
+
+/// Merkle airdrop using sorted-pair hashing of keccak256(abi.encodePacked(index, account, amount)) leaves.
+contract MerkleDistributor {
+    bytes32 public immutable merkleRoot;
+    mapping(uint256 => uint256) private claimedBitMap;
+    mapping(address => uint256) public claimed;
+
+    event Claimed(uint256 index, address account, uint256 amount);
+
+    constructor(bytes32 _merkleRoot) {
+        merkleRoot = _merkleRoot;
+    }
+
+    function isClaimed(uint256 index) public view returns (bool) {
+        uint256 word = claimedBitMap[index / 256];
+        uint256 mask = 1 << (index % 256);
+        return word & mask == mask;
+    }
+
+    function verify(bytes32[] calldata proof, bytes32 root, bytes32 leaf) public pure returns (bool) {
+        bytes32 computedHash = leaf;
+        for (uint256 i = 0; i < proof.length; i++) {
+            bytes32 proofElement = proof[i];
+            if (computedHash <= proofElement)
+                computedHash = keccak256(abi.encodePacked(computedHash, proofElement));
+            else
+                computedHash = keccak256(abi.encodePacked(proofElement, computedHash));
+        }
+        return computedHash == root;
+    }
+
+    function claim(uint256 index, address account, uint256 amount, bytes32[] calldata proof) external {
+        require(!isClaimed(index), "MerkleDistributor: drop already claimed");
+        bytes32 leaf = keccak256(abi.encodePacked(index, account, amount));
+        require(verify(proof, merkleRoot, leaf), "MerkleDistributor: invalid proof");
+        claimedBitMap[index / 256] |= 1 << (index % 256);
+        claimed[account] += amount;
+        emit Claimed(index, account, amount);
+    }
+}
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.8.0;
+
+/// ABI-heavy swap router: nested dynamic calldata, struct arrays, packed path encoding and multicall.
+contract Router {
+    struct Hop {
+        address pool;
+        uint24 fee;
+        bool zeroForOne;
+    }
+
+    struct Route {
+        Hop[] hops;
+        uint256 amountIn;
+        uint256 minAmountOut;
+        bytes extraData;
+    }
+
+    event Routed(address indexed sender, uint256 amountIn, uint256 amountOut, bytes path);
+
+    uint256 public routedVolume;
+
+    function encodePath(Hop[] calldata hops) public pure returns (bytes memory path) {
+        for (uint256 i = 0; i < hops.length; i++)
+            path = bytes.concat(path, abi.encodePacked(hops[i].pool, hops[i].fee, hops[i].zeroForOne));
+    }
+
+    function quote(Route calldata route) public pure returns (uint256 amountOut) {
+        amountOut = route.amountIn;
+        for (uint256 i = 0; i < route.hops.length; i++)
+            amountOut = amountOut * (1000000 - route.hops[i].fee) / 1000000;
+    }
+
+    function quoteAll(Route[] calldata routes) external pure returns (uint256[] memory amountsOut) {
+        amountsOut = new uint256[](routes.length);
+        for (uint256 i = 0; i < routes.length; i++)
+            amountsOut[i] = quote(routes[i]);
+    }
+
+    function execute(Route calldata route) public returns (uint256 amountOut) {
+        amountOut = quote(route);
+        require(amountOut >= route.minAmountOut, "Router: slippage");
+        routedVolume += route.amountIn;
+        emit Routed(msg.sender, route.amountIn, amountOut, encodePath(route.hops));
+    }
+
+    function multicall(bytes[] calldata data) external returns (bytes[] memory results) {
+        results = new bytes[](data.length);
+        for (uint256 i = 0; i < data.length; i++) {
+            (bool success, bytes memory result) = address(this).delegatecall(data[i]);
+            require(success, "Router: call failed");
+            results[i] = result;
+        }
+    }
+}
@@ -0,0 +1,255 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Measures the gas consumed by the code generated for a corpus of contracts and compares it
+ * to a stored baseline.
+ */
+
+#include <test/benchmarks/GasBenchmark.h>
+
+#include <test/Common.h>
+#include <test/EVMHost.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/exception/diagnostic_information.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace solidity;
+using namespace solidity::test::benchmarks;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+boost::filesystem::path defaultCorpusDirectory()
+{
+	for (boost::filesystem::path const prefix: {".", "..", "../.."})
+		if (boost::filesystem::is_directory(prefix / "test/benchmarks/gas"))
+			return prefix / "test/benchmarks/gas";
+	return {};
+}
+
+std::string defaultVM()
+{
+	if (char const* path = std::getenv("ETH_EVMONE"))
+		return path;
+	return test::evmoneFilename;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		std::string vmPath = defaultVM();
+		std::string evmVersionString;
+		std::string corpusDirectory = defaultCorpusDirectory().string();
+		std::string filter;
+		std::string configurationList;
+		std::string baselineFile;
+		std::string outputBaselineFile;
+		po::options_description options(
+			R"(gasbench, gas usage of the code generated for a corpus of contracts.
+	Usage: gasbench [Options]
+	Compiles every contract of the corpus with every configuration, runs its
+	transactions on a simulated chain and reports deployment gas, runtime code
+	size and the gas used by each transaction. If a baseline is given, the
+	differences to it are reported as well.
+
+	Allowed options)",
+			po::options_description::m_default_line_length,
+			po::options_description::m_default_line_length - 23);
+		options.add_options()
+			(
+				"vm",
+				po::value<std::string>(&vmPath)->default_value(vmPath),
+				"path to the evmc library used for execution"
+			)
+			(
+				"evm-version",
+				po::value<std::string>(&evmVersionString)->default_value(langutil::EVMVersion{}.name()),
+				"EVM version to compile for and to execute with"
+			)
+			(
+				"corpus",
+				po::value<std::string>(&corpusDirectory)->default_value(corpusDirectory),
+				"directory containing the contracts of the corpus"
+			)
+			(
+				"filter",
+				po::value<std::string>(&filter)->default_value(""),
+				"only run scenarios whose name contains this string"
+			)
+			(
+				"configurations",
+				po::value<std::string>(&configurationList)->default_value(""),
+				"comma-separated list of compiler configurations to use (default: all)"
+			)
+			(
+				"baseline",
+				po::value<std::string>(&baselineFile),
+				"compare the results against the measurements stored in this file"
+			)
+			(
+				"write-baseline",
+				po::value<std::string>(&outputBaselineFile),
+				"store the measurements in this file for later comparisons"
+			)
+			("fail-on-regression", "Exit with status 2 if any measurement is higher than in the baseline.")
+			("list", "List the names of all scenarios and configurations and exit.")
+			("help,h", "Show this help screen.");
+
+		po::variables_map arguments;
+		po::store(po::parse_command_line(argc, argv, options), arguments);
+		po::notify(arguments);
+
+		if (arguments.count("help"))
+		{
+			std::cout << options;
+			return 0;
+		}
+
+		std::vector<GasScenario> scenarios = gasScenarios();
+		std::vector<GasConfiguration> configurations = gasConfigurations();
+
+		if (arguments.count("list"))
+		{
+			for (GasScenario const& scenario: scenarios)
+				std::cout << scenario.name << std::endl;
+			for (GasConfiguration const& configuration: configurations)
+				std::cout << configuration.name << std::endl;
+			return 0;
+		}
+
+		std::optional<langutil::EVMVersion> evmVersion = langutil::EVMVersion::fromString(evmVersionString);
+		if (!evmVersion)
+		{
+			std::cerr << "Invalid EVM version: " << evmVersionString << std::endl;
+			return 1;
+		}
+		if (corpusDirectory.empty() || !boost::filesystem::is_directory(corpusDirectory))
+		{
+			std::cerr << "Corpus directory not found. Please specify it using --corpus." << std::endl;
+			return 1;
+		}
+		if (arguments.count("fail-on-regression") && baselineFile.empty())
+		{
+			std::cerr << "--fail-on-regression requires --baseline." << std::endl;
+			return 1;
+		}
+
+		if (!configurationList.empty())
+		{
+			std::vector<std::string> names;
+			boost::split(names, configurationList, boost::is_any_of(","));
+			std::vector<GasConfiguration> selected;
+			for (std::string const& name: names)
+			{
+				auto it = std::find_if(
+					configurations.begin(),
+					configurations.end(),
+					[&](GasConfiguration const& _configuration) { return _configuration.name == name; }
+				);
+				if (it == configurations.end())
+				{
+					std::cerr << "Unknown configuration: " << name << std::endl;
+					return 1;
+				}
+				selected.push_back(*it);
+			}
+			configurations = std::move(selected);
+		}
+
+		evmc::VM& vm = test::EVMHost::getVM(vmPath);
+		if (!vm)
+		{
+			std::cerr << "Unable to load the EVM from " << vmPath << ". Please specify it using --vm." << std::endl;
+			return 1;
+		}
+
+		GasBenchmarkRunner runner{vm, *evmVersion, corpusDirectory};
+		Json::Value measurements{Json::objectValue};
+		for (GasConfiguration const& configuration: configurations)
+			for (GasScenario const& scenario: scenarios)
+			{
+				if (scenario.name.find(filter) == std::string::npos)
+					continue;
+				for (auto const& [name, value]: runner.run(scenario, configuration))
+					measurements[configuration.name + "/" + scenario.name + "/" + name] = static_cast<Json::Int64>(value);
+			}
+
+		Json::Value output{Json::objectValue};
+		output["evmVersion"] = evmVersion->name();
+		output["measurements"] = measurements;
+
+		bool regression = false;
+		if (!baselineFile.empty())
+		{
+			Json::Value baseline;
+			std::string errors;
+			if (!util::jsonParseStrict(util::readFileAsString(baselineFile), baseline, &errors))
+			{
+				std::cerr << "Invalid baseline " << baselineFile << ": " << errors << std::endl;
+				return 1;
+			}
+			if (baseline.isMember("evmVersion") && baseline["evmVersion"] != output["evmVersion"])
+				std::cerr << "Warning: the baseline was measured for EVM version " << baseline["evmVersion"].asString() << std::endl;
+			Json::Value diff = diffAgainstBaseline(baseline["measurements"], measurements);
+			for (std::string const& name: diff["changed"].getMemberNames())
+				if (diff["changed"][name]["delta"].asInt64() > 0)
+					regression = true;
+			output["diff"] = std::move(diff);
+		}
+
+		if (!outputBaselineFile.empty())
+		{
+			Json::Value baseline{Json::objectValue};
+			baseline["evmVersion"] = output["evmVersion"];
+			baseline["measurements"] = measurements;
+			std::ofstream(outputBaselineFile) << util::jsonPrettyPrint(baseline) << std::endl;
+		}
+
+		std::cout << util::jsonPrettyPrint(output) << std::endl;
+
+		if (regression && arguments.count("fail-on-regression"))
+			return 2;
+		return 0;
+	}
+	catch (po::error const& _exception)
+	{
+		std::cerr << _exception.what() << std::endl;
+		return 1;
+	}
+	catch (...)
+	{
+		std::cerr << "Exception:" << std::endl;
+		std::cerr << boost::current_exception_diagnostic_information() << std::endl;
+		return 1;
+	}
+}
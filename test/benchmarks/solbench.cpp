@@ -0,0 +1,151 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Microbenchmarks of compiler internals.
+ */
+
+#include <test/benchmarks/Benchmarks.h>
+
+#include <libsolutil/JSON.h>
+
+#include <boost/exception/diagnostic_information.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <iostream>
+#include <string>
+
+using namespace solidity;
+using namespace solidity::test::benchmarks;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+boost::filesystem::path defaultInputDirectory()
+{
+	for (boost::filesystem::path const prefix: {".", "..", "../.."})
+		if (boost::filesystem::is_regular_file(prefix / "test/benchmarks/verifier.sol"))
+			return prefix / "test/benchmarks";
+	return {};
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		size_t samples = 15;
+		double minSampleTime = 0.05;
+		std::string filter;
+		std::string inputDirectory = defaultInputDirectory().string();
+		po::options_description options(
+			R"(solbench, microbenchmarks of compiler internals.
+	Usage: solbench [Options]
+	Runs all benchmarks whose name contains the filter and reports the median
+	time per execution together with the median absolute deviation.
+
+	Allowed options)",
+			po::options_description::m_default_line_length,
+			po::options_description::m_default_line_length - 23);
+		options.add_options()
+			(
+				"filter",
+				po::value<std::string>(&filter)->default_value(""),
+				"only run benchmarks whose name contains this string"
+			)
+			(
+				"samples",
+				po::value<size_t>(&samples)->default_value(15),
+				"number of measured samples per benchmark"
+			)
+			(
+				"min-sample-time",
+				po::value<double>(&minSampleTime)->default_value(0.05),
+				"minimum duration of a single sample in seconds"
+			)
+			(
+				"input-dir",
+				po::value<std::string>(&inputDirectory)->default_value(inputDirectory),
+				"directory containing the Solidity inputs of the compiler benchmarks (test/benchmarks)"
+			)
+			("list", "List the names of all benchmarks and exit.")
+			("json", "Output the results as JSON.")
+			("help,h", "Show this help screen.");
+
+		po::variables_map arguments;
+		po::store(po::parse_command_line(argc, argv, options), arguments);
+		po::notify(arguments);
+
+		if (arguments.count("help"))
+		{
+			std::cout << options;
+			return 0;
+		}
+		if (samples == 0)
+		{
+			std::cerr << "Number of samples must be positive." << std::endl;
+			return 1;
+		}
+
+		std::vector<Benchmark> benchmarks = keccakBenchmarks();
+		if (!inputDirectory.empty() && boost::filesystem::is_directory(inputDirectory))
+			for (auto const& group: {frontendBenchmarks(inputDirectory), backendBenchmarks(inputDirectory)})
+				benchmarks.insert(benchmarks.end(), group.begin(), group.end());
+		else
+			std::cerr << "Input directory not found, skipping the compiler benchmarks. Please specify it using --input-dir." << std::endl;
+
+		if (arguments.count("list"))
+		{
+			for (Benchmark const& benchmark: benchmarks)
+				std::cout << benchmark.name << std::endl;
+			return 0;
+		}
+
+		bool const json = arguments.count("json") > 0;
+		BenchmarkRunner runner{samples, minSampleTime};
+		Json::Value results{Json::arrayValue};
+		for (Benchmark const& benchmark: benchmarks)
+		{
+			if (benchmark.name.find(filter) == std::string::npos)
+				continue;
+			Measurement measurement = runner.run(benchmark);
+			if (json)
+				results.append(measurement.toJson());
+			else
+				std::cout << formatMeasurement(measurement) << std::endl;
+		}
+		if (json)
+			std::cout << util::jsonPrettyPrint(results) << std::endl;
+
+		return 0;
+	}
+	catch (po::error const& _exception)
+	{
+		std::cerr << _exception.what() << std::endl;
+		return 1;
+	}
+	catch (...)
+	{
+		std::cerr << "Exception:" << std::endl;
+		std::cerr << boost::current_exception_diagnostic_information() << std::endl;
+		return 1;
+	}
+}
@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.0;
+
+contract C {
+    uint counter;
+    modifier counted(uint a) {
+        require(a > 0, "zero");
+        counter += a;
+        _;
+        counter -= 1;
+    }
+    function f(uint a) public counted(a) returns (uint) { return a + counter; }
+    function g(uint a) public counted(a) returns (uint) { return a * counter; }
+    function h(uint a) public counted(a) counted(a + 1) returns (uint) { return counter - a; }
+}
@@ -401,6 +401,31 @@ BOOST_AUTO_TEST_CASE(immutable)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(binary_source_mapping)
+{
+	auto rootName = std::make_shared<std::string>("root.asm");
+	auto subName = std::make_shared<std::string>("sub.asm");
+	std::map<std::string, unsigned> indices = {
+		{ *rootName, 0 },
+		{ *subName, 1 }
+	};
+
+	AssemblyItems items;
+	items.emplace_back(Instruction::ADD, SourceLocation{10, 15, rootName});
+	items.emplace_back(Instruction::ADD, SourceLocation{10, 15, rootName});
+	items.back().setJumpType(AssemblyItem::JumpType::IntoFunction);
+	items.emplace_back(u256(1), SourceLocation{12, 15, subName});
+	items.emplace_back(Instruction::ADD);
+
+	BOOST_CHECK_EQUAL(AssemblyItem::computeSourceMapping(items, indices), "10:5:0:-:0;:::i;12:3:1:-;-1:-1:-1");
+	BOOST_CHECK(AssemblyItem::computeBinarySourceMapping(items, indices) == (bytes{
+		0x0f, 0x0b, 0x05, 0x00, 0x00,
+		0x10,
+		0x07, 0x02, 0x03, 0x01,
+		0x07, 0x73, 0x7f, 0x7f
+	}));
+}
+
 BOOST_AUTO_TEST_CASE(subobject_encode_decode)
 {
 	EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
@@ -116,6 +116,9 @@ SemanticTest::SemanticTest(
 		m_compiler.setMetadataFormat(CompilerStack::MetadataFormat::NoMetadata);
 		m_compiler.setMetadataHash(CompilerStack::MetadataHash::None);
 	}
+
+	if (!solidity::test::CommonOptions::get().bytecodeCache.empty())
+		m_bytecodeCache.emplace(solidity::test::CommonOptions::get().bytecodeCache);
 }
 
 std::map<std::string, Builtin> SemanticTest::makeBuiltins()
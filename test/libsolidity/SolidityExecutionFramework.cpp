@@ -68,7 +68,36 @@ bytes SolidityExecutionFramework::multiSourceCompileContract(
 	}
 	m_compiler.setMetadataHash(m_metadataHash);
 
-	if (!m_compiler.compile())
+	if (!m_bytecodeCache)
+		compileOrFail(CompilerStack::State::CompilationSuccessful);
+	else
+		compileOrFail(CompilerStack::State::AnalysisSuccessful);
+
+	std::string contractName(_contractName.empty() ? m_compiler.lastContractName(_mainSourceName) : _contractName);
+	if (m_showMetadata)
+		std::cout << "metadata: " << m_compiler.metadata(contractName) << std::endl;
+
+	// The metadata covers the sources, the compiler version and all settings that
+	// affect code generation, so it identifies the bytecode.
+	std::string cacheKey;
+	if (m_bytecodeCache)
+	{
+		cacheKey = m_compiler.metadata(contractName);
+		if (std::optional<bytes> bytecode = m_bytecodeCache->find(cacheKey))
+			return *bytecode;
+		compileOrFail(CompilerStack::State::CompilationSuccessful);
+	}
+
+	evmasm::LinkerObject obj = m_compiler.object(contractName);
+	BOOST_REQUIRE(obj.linkReferences.empty());
+	if (m_bytecodeCache)
+		m_bytecodeCache->store(cacheKey, obj.bytecode);
+	return obj.bytecode;
+}
+
+void SolidityExecutionFramework::compileOrFail(CompilerStack::State _stopAfter)
+{
+	if (!m_compiler.compile(_stopAfter))
 	{
 		// The testing framework expects an exception for
 		// "unimplemented" yul IR generation.
@@ -80,12 +109,6 @@ bytes SolidityExecutionFramework::multiSourceCompileContract(
 			.printErrorInformation(m_compiler.errors());
 		BOOST_ERROR("Compiling contract failed");
 	}
-	std::string contractName(_contractName.empty() ? m_compiler.lastContractName(_mainSourceName) : _contractName);
-	evmasm::LinkerObject obj = m_compiler.object(contractName);
-	BOOST_REQUIRE(obj.linkReferences.empty());
-	if (m_showMetadata)
-		std::cout << "metadata: " << m_compiler.metadata(contractName) << std::endl;
-	return obj.bytecode;
 }
 
 bytes SolidityExecutionFramework::compileContract(
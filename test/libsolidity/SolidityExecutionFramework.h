@@ -26,6 +26,7 @@
 #include <functional>
 
 #include <test/ExecutionFramework.h>
+#include <test/libsolidity/util/BytecodeCache.h>
 
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolidity/interface/DebugSettings.h>
@@ -81,6 +82,10 @@ public:
 
 protected:
 	using CompilerStack = solidity::frontend::CompilerStack;
+
+	/// Compiles the sources set in m_compiler up to the given state and reports errors.
+	void compileOrFail(CompilerStack::State _stopAfter);
+
 	std::optional<uint8_t> m_eofVersion;
 	CompilerStack m_compiler;
 	bool m_compileViaYul = false;
@@ -88,6 +93,10 @@ protected:
 	bool m_appendCBORMetadata = true;
 	CompilerStack::MetadataHash m_metadataHash = CompilerStack::MetadataHash::IPFS;
 	RevertStrings m_revertStrings = RevertStrings::Default;
+	/// If set, code generation is skipped for contracts whose bytecode is in the cache.
+	/// m_compiler is then only analyzed, so this must only be used by tests that do not
+	/// query its code generation outputs.
+	std::optional<BytecodeCache> m_bytecodeCache;
 };
 
 } // end namespaces
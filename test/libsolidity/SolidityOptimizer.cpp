@@ -724,6 +724,42 @@ BOOST_AUTO_TEST_CASE(avoid_double_cleanup)
 	BOOST_CHECK_EQUAL(numInstructions(m_nonOptimizedBytecode, Instruction::AND), 1);
 }
 
+BOOST_AUTO_TEST_CASE(share_modifier_code)
+{
+	// Modifier code is only shared by the legacy code generator.
+	if (m_compileViaYul)
+		return;
+
+	char const* sourceCode = R"(
+		contract C {
+			uint counter;
+			modifier counted(uint a) {
+				require(a > 0, "zero");
+				counter += a;
+				_;
+				counter -= 1;
+			}
+			function f(uint a) public counted(a) returns (uint) { return a + counter; }
+			function g(uint a) public counted(a) returns (uint) { return a * counter; }
+			function h(uint a) public counted(a) counted(a + 1) returns (uint) { return counter - a; }
+		}
+	)";
+	OptimiserSettings previousSettings = m_optimiserSettings;
+	m_optimiserSettings = OptimiserSettings::standard();
+	m_optimiserSettings.expectedExecutionsPerDeployment = 1;
+	m_nonOptimizedBytecode = compileAndRun(sourceCode, 0, "C");
+	m_nonOptimizedContract = m_contractAddress;
+	m_optimiserSettings.shareModifierCode = true;
+	m_optimizedBytecode = compileAndRun(sourceCode, 0, "C");
+	m_optimizedContract = m_contractAddress;
+	m_optimiserSettings = previousSettings;
+
+	BOOST_CHECK_LT(numInstructions(m_optimizedBytecode), numInstructions(m_nonOptimizedBytecode));
+	compareVersions("f(uint256)", 3);
+	compareVersions("g(uint256)", 3);
+	compareVersions("h(uint256)", 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
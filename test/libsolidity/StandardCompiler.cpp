@@ -1223,6 +1223,42 @@ BOOST_AUTO_TEST_CASE(optimizer_settings_details_different)
 	BOOST_CHECK(optimizer["runs"].asUInt() == 600);
 }
 
+BOOST_AUTO_TEST_CASE(optimizer_settings_details_share_modifier_code)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"outputSelection": {
+				"fileA": { "A": [ "metadata" ] }
+			},
+			"optimizer": { "enabled": true, "details": {
+				"shareModifierCode": true
+			} }
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value contract = getContractResult(result, "fileA", "A");
+	BOOST_CHECK(contract.isObject());
+	BOOST_CHECK(contract["metadata"].isString());
+	Json::Value metadata;
+	BOOST_CHECK(util::jsonParseStrict(contract["metadata"].asString(), metadata));
+
+	Json::Value const& optimizer = metadata["settings"]["optimizer"];
+	BOOST_CHECK(!optimizer.isMember("enabled"));
+	BOOST_CHECK(optimizer.isMember("details"));
+	BOOST_CHECK(optimizer["details"]["shareModifierCode"].asBool() == true);
+	BOOST_CHECK(optimizer["details"]["inliner"].asBool() == true);
+	BOOST_CHECK_EQUAL(optimizer["details"].getMemberNames().size(), 10);
+}
+
 BOOST_AUTO_TEST_CASE(metadata_without_compilation)
 {
 	// NOTE: the contract code here should fail to compile due to "out of stack"
@@ -1257,6 +1293,55 @@ BOOST_AUTO_TEST_CASE(metadata_without_compilation)
 }
 
 
+BOOST_AUTO_TEST_CASE(telemetry)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"telemetry": true,
+			"outputSelection": {
+				"fileA": { "A": [ "evm.bytecode.object" ] }
+			}
+		},
+		"sources": {
+			"fileA": { "content": "contract A { function f() public pure returns (uint) { return 1; } }" }
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	BOOST_REQUIRE(result["telemetry"]["phases"].isArray());
+
+	set<string> phases;
+	for (Json::Value const& phase: result["telemetry"]["phases"])
+	{
+		BOOST_REQUIRE(phase["phase"].isString());
+		BOOST_CHECK(phase["wallTimeMicroseconds"].isInt64());
+		phases.insert(phase["phase"].asString());
+		if (phase["phase"].asString() == "compilation/evmCodeGeneration")
+			BOOST_CHECK_EQUAL(phase["contract"].asString(), "fileA:A");
+	}
+	for (string phase: {"parsing", "analysis", "analysis/typeChecking", "compilation", "compilation/evmCodeGeneration", "compilation/assembly"})
+		BOOST_CHECK_MESSAGE(phases.count(phase), "Missing phase " + phase);
+	BOOST_CHECK_EQUAL(result["telemetry"]["phases"][0]["phase"].asString(), "parsing");
+}
+
+BOOST_AUTO_TEST_CASE(telemetry_disabled_by_default)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": { "content": "contract A { }" }
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	BOOST_CHECK(!result.isMember("telemetry"));
+}
+
 BOOST_AUTO_TEST_CASE(license_in_metadata)
 {
 	string const input = R"(
@@ -14,13 +14,13 @@ contract C {
 }
 // ----
 // creation:
-//   codeDepositCost: 1213200
-//   executionCost: 1259
-//   totalCost: 1214459
+//   codeDepositCost: 1227400
+//   executionCost: 1273
+//   totalCost: 1228673
 // external:
-//   a(): 2425
-//   b(uint256): infinite
-//   f1(uint256): infinite
+//   a(): 2391
+//   b(uint256): 4779
+//   f1(uint256): 449
 //   f2(uint256[],string[],uint16,address): infinite
 //   f3(uint16[],string[],uint16,address): infinite
 //   f4(uint32[],string[12],bytes[2][],address): infinite
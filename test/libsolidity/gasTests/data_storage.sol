@@ -13,8 +13,8 @@ contract C {
 }
 // ----
 // creation:
-//   codeDepositCost: 377800
-//   executionCost: 416
-//   totalCost: 378216
+//   codeDepositCost: 299800
+//   executionCost: 335
+//   totalCost: 300135
 // external:
 //   f(): 421
@@ -24,29 +24,29 @@ contract Large {
 }
 // ----
 // creation:
-//   codeDepositCost: 618400
-//   executionCost: 649
-//   totalCost: 619049
+//   codeDepositCost: 605200
+//   executionCost: 636
+//   totalCost: 605836
 // external:
-//   a(): 2470
-//   b(uint256): infinite
-//   f0(uint256): infinite
-//   f1(uint256): infinite
-//   f2(uint256): infinite
-//   f3(uint256): infinite
-//   f4(uint256): infinite
-//   f5(uint256): infinite
-//   f6(uint256): infinite
-//   f7(uint256): infinite
-//   f8(uint256): infinite
-//   f9(uint256): infinite
-//   g0(uint256): infinite
-//   g1(uint256): infinite
-//   g2(uint256): infinite
-//   g3(uint256): infinite
-//   g4(uint256): infinite
-//   g5(uint256): infinite
-//   g6(uint256): infinite
-//   g7(uint256): infinite
-//   g8(uint256): infinite
-//   g9(uint256): infinite
+//   a(): 2436
+//   b(uint256): 4757
+//   f0(uint256): 540
+//   f1(uint256): 46960
+//   f2(uint256): 24803
+//   f3(uint256): 24891
+//   f4(uint256): 24869
+//   f5(uint256): 24847
+//   f6(uint256): 24870
+//   f7(uint256): 24782
+//   f8(uint256): 24782
+//   f9(uint256): 24804
+//   g0(uint256): 426
+//   g1(uint256): 46915
+//   g2(uint256): 24780
+//   g3(uint256): 24868
+//   g4(uint256): 24846
+//   g5(uint256): 24802
+//   g6(uint256): 24825
+//   g7(uint256): 24824
+//   g8(uint256): 24802
+//   g9(uint256): 24759
@@ -11,16 +11,16 @@ contract Medium {
 }
 // ----
 // creation:
-//   codeDepositCost: 259600
-//   executionCost: 298
-//   totalCost: 259898
+//   codeDepositCost: 246400
+//   executionCost: 285
+//   totalCost: 246685
 // external:
-//   a(): 2447
-//   b(uint256): infinite
-//   f1(uint256): infinite
-//   f2(uint256): infinite
-//   f3(uint256): infinite
-//   g0(uint256): infinite
-//   g7(uint256): infinite
-//   g8(uint256): infinite
-//   g9(uint256): infinite
+//   a(): 2413
+//   b(uint256): 4757
+//   f1(uint256): 46871
+//   f2(uint256): 24803
+//   f3(uint256): 24847
+//   g0(uint256): 426
+//   g7(uint256): 24802
+//   g8(uint256): 24780
+//   g9(uint256): 24736
@@ -6,11 +6,11 @@ contract Small {
 }
 // ----
 // creation:
-//   codeDepositCost: 103800
-//   executionCost: 151
-//   totalCost: 103951
+//   codeDepositCost: 90600
+//   executionCost: 139
+//   totalCost: 90739
 // external:
 //   fallback: 128
-//   a(): 2402
-//   b(uint256): infinite
-//   f1(uint256): infinite
+//   a(): 2368
+//   b(uint256): 4713
+//   f1(uint256): 46871
@@ -19,11 +19,11 @@ contract C {
 // optimize-yul: false
 // ----
 // creation:
-//   codeDepositCost: 107000
-//   executionCost: 151
-//   totalCost: 107151
+//   codeDepositCost: 91000
+//   executionCost: 139
+//   totalCost: 91139
 // external:
-//   exp_neg_one(uint256): 2250
-//   exp_one(uint256): infinite
-//   exp_two(uint256): infinite
-//   exp_zero(uint256): infinite
+//   exp_neg_one(uint256): 2070
+//   exp_one(uint256): 2026
+//   exp_two(uint256): 2004
+//   exp_zero(uint256): 2047
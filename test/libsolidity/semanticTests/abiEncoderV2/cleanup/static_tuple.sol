@@ -0,0 +1,23 @@
+pragma abicoder               v2;
+
+contract C {
+    function dirty() internal pure returns (uint8 a, int16 b, bool c, bytes2 d, address e) {
+        assembly {
+            a := 0x1ff
+            b := 0x18000
+            c := 2
+            d := 0x12340000000000000000000000000000000000000000000000000000000000ff
+            e := not(0)
+        }
+    }
+    function f() public pure returns (uint8, int16, bool, bytes2, address) {
+        return dirty();
+    }
+    function g() public pure returns (bytes memory) {
+        (uint8 a, int16 b, bool c, bytes2 d, address e) = dirty();
+        return abi.encode(a, b, c, d, e);
+    }
+}
+// ----
+// f() -> 0xff, -32768, true, left(0x1234), 0xffffffffffffffffffffffffffffffffffffffff
+// g() -> 0x20, 0xa0, 0xff, -32768, true, left(0x1234), 0xffffffffffffffffffffffffffffffffffffffff
@@ -0,0 +1,22 @@
+pragma abicoder               v2;
+
+contract C {
+    enum E { A, B, C }
+    function f(uint8 a, int16 b, bool c, bytes2 d, address e, E g) external pure returns (uint8, int16, bool, bytes2, address, E) {
+        return (a, b, c, d, e, g);
+    }
+    function g(bool a, uint256[] calldata b, uint8 c) external pure returns (uint256) {
+        return (a ? 1 : 0) + b.length + c;
+    }
+}
+// ----
+// f(uint8,int16,bool,bytes2,address,uint8): 1, -2, true, left(0x0003), 4, 2 -> 1, -2, true, left(0x0003), 4, 2
+// f(uint8,int16,bool,bytes2,address,uint8): 0x100, -2, true, left(0x0003), 4, 2 -> FAILURE
+// f(uint8,int16,bool,bytes2,address,uint8): 1, 0x8000, true, left(0x0003), 4, 2 -> FAILURE
+// f(uint8,int16,bool,bytes2,address,uint8): 1, -2, 2, left(0x0003), 4, 2 -> FAILURE
+// f(uint8,int16,bool,bytes2,address,uint8): 1, -2, true, left(0x000301), 4, 2 -> FAILURE
+// f(uint8,int16,bool,bytes2,address,uint8): 1, -2, true, left(0x0003), 0x010000000000000000000000000000000000000000, 2 -> FAILURE
+// f(uint8,int16,bool,bytes2,address,uint8): 1, -2, true, left(0x0003), 4, 3 -> FAILURE
+// g(bool,uint256[],uint8): true, 0x60, 7, 2, 1, 2 -> 10
+// g(bool,uint256[],uint8): 2, 0x60, 7, 2, 1, 2 -> FAILURE
+// g(bool,uint256[],uint8): true, 0x60, 0x100, 2, 1, 2 -> FAILURE
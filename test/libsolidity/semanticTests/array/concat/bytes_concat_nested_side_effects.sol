@@ -0,0 +1,25 @@
+contract C {
+    function modify(bytes memory a) internal pure returns (bytes memory) {
+        a[0] = "z";
+        return a;
+    }
+
+    function f() public pure returns (bytes memory) {
+        bytes memory a = "ab";
+        return bytes.concat(bytes.concat(a, "x"), modify(a));
+    }
+
+    function g() public pure returns (bytes memory) {
+        bytes memory a = "ab";
+        return abi.encodePacked(abi.encodePacked(a, uint8(1)), modify(a));
+    }
+
+    function h() public pure returns (bytes memory) {
+        bytes memory a = "ab";
+        return bytes.concat(modify(a), bytes.concat(a, bytes.concat("x", a)));
+    }
+}
+// ----
+// f() -> 0x20, 5, "abxzb"
+// g() -> 0x20, 5, "ab\x01zb"
+// h() -> 0x20, 7, "zbzbxzb"
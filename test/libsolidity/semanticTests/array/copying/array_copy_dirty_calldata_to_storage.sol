@@ -0,0 +1,17 @@
+contract C {
+    uint8[] a;
+    bytes2[] b;
+    function fromUint8(uint8[] calldata c) public returns (uint8[] memory) {
+        a = c;
+        return a;
+    }
+    function fromBytes2(bytes2[] calldata c) public returns (bytes2[] memory) {
+        b = c;
+        return b;
+    }
+}
+// ====
+// compileViaYul: false
+// ----
+// fromUint8(uint8[]): 0x20, 3, 0x0101, 0xff02, 3 -> 0x20, 3, 1, 2, 3
+// fromBytes2(bytes2[]): 0x20, 2, 0x0102000000000000000000000000000000000000000000000000000000000001, 0x0304ff0000000000000000000000000000000000000000000000000000000000 -> 0x20, 2, left(0x0102), left(0x0304)
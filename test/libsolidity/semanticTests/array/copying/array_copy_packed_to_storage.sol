@@ -0,0 +1,34 @@
+contract C {
+    uint8[] a;
+    uint16[5] b;
+    function fromMemory(uint256 len) public returns (uint256, uint8, uint8, uint256) {
+        for (uint256 i = 0; i < 70; i++)
+            a.push(0xff);
+        uint8[] memory m = new uint8[](len);
+        for (uint256 i = 0; i < len; i++)
+            m[i] = uint8(i + 1);
+        a = m;
+        uint256 slot;
+        assembly { slot := a.slot }
+        bytes32 h = keccak256(abi.encode(slot));
+        uint256 lastSlot;
+        assembly { lastSlot := sload(add(h, 2)) }
+        return (a.length, a[0], a[len - 1], lastSlot);
+    }
+    function fromCalldata(uint8[] calldata c) public returns (uint256, uint8, uint8) {
+        a = c;
+        return (a.length, a[0], a[a.length - 1]);
+    }
+    function toStatic(uint16[3] calldata c) public returns (uint16, uint16, uint16, uint16, uint16) {
+        for (uint256 i = 0; i < 5; i++)
+            b[i] = 7;
+        uint16[3] memory m = c;
+        b = [m[0], m[1], m[2], 0, 0];
+        return (b[0], b[1], b[2], b[3], b[4]);
+    }
+}
+// ----
+// fromMemory(uint256): 33 -> 33, 1, 33, 0
+// fromMemory(uint256): 65 -> 65, 1, 65, 65
+// fromCalldata(uint8[]): 0x20, 3, 4, 5, 6 -> 3, 4, 6
+// toStatic(uint16[3]): 1, 2, 3 -> 1, 2, 3, 0, 0
@@ -0,0 +1,16 @@
+contract C {
+    function f(address account, uint256 slot, uint256 blockNumber) public view returns (bytes32) {
+        return caerus(account, slot, blockNumber);
+    }
+    function freeMemoryPointerUnchanged() public view returns (bool) {
+        uint256 before;
+        uint256 afterCall;
+        assembly { before := mload(0x40) }
+        caerus(address(this), 1, 2);
+        assembly { afterCall := mload(0x40) }
+        return before == afterCall;
+    }
+}
+// ----
+// f(address,uint256,uint256): 0x1234, 1, 2 -> 0
+// freeMemoryPointerUnchanged() -> true
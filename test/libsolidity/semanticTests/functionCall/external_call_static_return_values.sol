@@ -0,0 +1,45 @@
+enum E { A, B, C }
+interface I {
+    function values() external view returns (uint8, int16, bool, address, bytes3, E);
+    function narrow() external view returns (uint8);
+    function pair() external view returns (uint, uint);
+}
+contract D {
+    uint x = 300;
+    function values() external view returns (uint, int, bool, address, bytes32, uint) {
+        return (x - 100, -2, true, address(0x1234), "abc", 2);
+    }
+    function narrow() external view returns (uint) { return x; }
+    function pair() external view returns (uint) { return x; }
+}
+contract C {
+    I d = I(address(new D()));
+    function values() public view returns (uint8, int16, bool, address, bytes3, E, uint) {
+        uint freeMemoryBefore;
+        assembly { freeMemoryBefore := mload(0x40) }
+        (uint8 a, int16 b, bool c, address e, bytes3 f, E g) = d.values();
+        uint freeMemoryAfter;
+        assembly { freeMemoryAfter := mload(0x40) }
+        return (a, b, c, e, f, g, freeMemoryAfter - freeMemoryBefore);
+    }
+    function narrow() public view returns (uint8) {
+        return d.narrow();
+    }
+    function pair() public view returns (uint, uint) {
+        return d.pair();
+    }
+    function tryNarrow() public view returns (bool, uint8) {
+        try d.narrow() returns (uint8 v) {
+            return (true, v);
+        } catch {
+            return (false, 0);
+        }
+    }
+}
+// ====
+// EVMVersion: >=byzantium
+// ----
+// values() -> 200, -2, true, 0x1234, "abc", 2, 0
+// narrow() -> FAILURE
+// pair() -> FAILURE
+// tryNarrow() -> FAILURE
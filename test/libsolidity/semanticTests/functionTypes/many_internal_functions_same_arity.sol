@@ -0,0 +1,38 @@
+contract C {
+    function f0(uint x) internal pure returns (uint) { return x; }
+    function f1(uint x) internal pure returns (uint) { return x + 1; }
+    function f2(uint x) internal pure returns (uint) { return x + 2; }
+    function f3(uint x) internal pure returns (uint) { return x + 3; }
+    function f4(uint x) internal pure returns (uint) { return x + 4; }
+    function f5(uint x) internal pure returns (uint) { return x + 5; }
+    function f6(uint x) internal pure returns (uint) { return x + 6; }
+    function f7(uint x) internal pure returns (uint) { return x + 7; }
+    function f8(uint x) internal pure returns (uint) { return x + 8; }
+
+    function select(uint i) internal pure returns (function (uint) internal pure returns (uint)) {
+        function (uint) internal pure returns (uint)[9] memory fs = [f0, f1, f2, f3, f4, f5, f6, f7, f8];
+        return fs[i];
+    }
+
+    function call(uint i, uint x) public pure returns (uint) {
+        return select(i)(x);
+    }
+
+    function sum(uint x) public pure returns (uint r) {
+        for (uint i = 0; i < 9; i++)
+            r += select(i)(x);
+    }
+
+    function callUninitialized(uint x) public pure returns (uint) {
+        function (uint) internal pure returns (uint) g;
+        return g(x);
+    }
+}
+// ----
+// call(uint256,uint256): 0, 10 -> 10
+// call(uint256,uint256): 4, 10 -> 14
+// call(uint256,uint256): 5, 10 -> 15
+// call(uint256,uint256): 8, 10 -> 18
+// sum(uint256): 1 -> 45
+// call(uint256,uint256): 9, 10 -> FAILURE, hex"4e487b71", 0x32
+// callUninitialized(uint256): 10 -> FAILURE, hex"4e487b71", 0x51
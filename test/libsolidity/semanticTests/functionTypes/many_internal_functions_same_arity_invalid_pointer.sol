@@ -0,0 +1,25 @@
+contract C {
+    function f0(uint x) internal pure returns (uint) { return x; }
+    function f1(uint x) internal pure returns (uint) { return x + 1; }
+    function f2(uint x) internal pure returns (uint) { return x + 2; }
+    function f3(uint x) internal pure returns (uint) { return x + 3; }
+    function f4(uint x) internal pure returns (uint) { return x + 4; }
+    function f5(uint x) internal pure returns (uint) { return x + 5; }
+    function f6(uint x) internal pure returns (uint) { return x + 6; }
+    function f7(uint x) internal pure returns (uint) { return x + 7; }
+    function f8(uint x) internal pure returns (uint) { return x + 8; }
+
+    function callInvalid(uint id, uint x) public pure returns (uint) {
+        // Reference all functions, so that they are part of the dispatch.
+        function (uint) internal pure returns (uint)[9] memory fs = [f0, f1, f2, f3, f4, f5, f6, f7, f8];
+        function (uint) internal pure returns (uint) g = fs[x];
+        assembly { g := id }
+        return g(x);
+    }
+}
+// ====
+// compileViaYul: true
+// ----
+// callInvalid(uint256,uint256): 0, 1 -> FAILURE, hex"4e487b71", 0x51
+// callInvalid(uint256,uint256): 1000, 1 -> FAILURE, hex"4e487b71", 0x51
+// callInvalid(uint256,uint256): 0xffffffffffffffff, 1 -> FAILURE, hex"4e487b71", 0x51
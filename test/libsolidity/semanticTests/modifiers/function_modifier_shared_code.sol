@@ -0,0 +1,56 @@
+contract C {
+    address owner = msg.sender;
+    uint locked = 1;
+    uint public calls;
+    uint[] public log;
+
+    modifier onlyOwner() {
+        require(msg.sender == owner, "not owner");
+        _;
+    }
+    modifier nonReentrant() {
+        require(locked == 1, "reentrant");
+        locked = 2;
+        _;
+        locked = 1;
+    }
+    modifier logged(uint tag, uint[] memory extra) {
+        log.push(tag);
+        for (uint i = 0; i < extra.length; ++i)
+            log.push(extra[i]);
+        _;
+        uint count = calls;
+        calls = count + 1;
+        log.push(tag + count);
+    }
+
+    function a(uint x) public onlyOwner nonReentrant logged(10, new uint[](0)) returns (uint) {
+        return x + 1;
+    }
+    function b(uint x) public onlyOwner nonReentrant logged(20, new uint[](2)) returns (uint r) {
+        r = x * 2;
+        if (x > 5)
+            return r + 1;
+    }
+    function c() public nonReentrant logged(30, new uint[](0)) logged(40, new uint[](1)) {
+        this.e();
+    }
+    function e() public nonReentrant {}
+    function d() public onlyOwner returns (uint) {
+        return locked;
+    }
+    function logLength() public view returns (uint) {
+        return log.length;
+    }
+}
+// ----
+// a(uint256): 4 -> 5
+// b(uint256): 3 -> 6
+// b(uint256): 6 -> 13
+// d() -> 1
+// calls() -> 3
+// logLength() -> 10
+// log(uint256): 5 -> 21
+// log(uint256): 9 -> 22
+// c() -> FAILURE, hex"08c379a0", 0x20, 9, "reentrant"
+// calls() -> 3
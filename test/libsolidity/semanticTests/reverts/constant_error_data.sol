@@ -0,0 +1,21 @@
+error E(string a, uint256 b, int8 c, bytes2 d);
+contract C {
+    function f(bool c) public pure {
+        require(c, "0123456789abcdef0123456789abcdef01234567");
+    }
+    function g() public pure {
+        revert("0123456789abcdef0123456789abcdef01234567");
+    }
+    function h() public pure {
+        revert E("0123456789abcdef0123456789abcdef01234567", 7, -1, "ab");
+    }
+    function i(bool c) public pure {
+        require(c, "short");
+    }
+}
+// ----
+// f(bool): true ->
+// f(bool): false -> FAILURE, hex"08c379a0", 0x20, 40, "0123456789abcdef0123456789abcdef", "01234567"
+// g() -> FAILURE, hex"08c379a0", 0x20, 40, "0123456789abcdef0123456789abcdef", "01234567"
+// h() -> FAILURE, hex"d7614b63", 0x80, 7, -1, left(0x6162), 40, "0123456789abcdef0123456789abcdef", "01234567"
+// i(bool): false -> FAILURE, hex"08c379a0", 0x20, 5, "short"
@@ -0,0 +1,37 @@
+struct S {
+    uint a;
+    uint b;
+}
+
+library L {
+    function sum(S storage _s) external view returns (uint) {
+        return _s.a + _s.b;
+    }
+}
+
+contract C {
+    S s;
+
+    function set() public {
+        s.a = 1;
+        s.b = 2;
+    }
+    function sumViaInternal() internal view returns (uint) {
+        return L.sum(s);
+    }
+    function readWithLibraryCall() public view returns (uint, uint, uint) {
+        S memory x = s;
+        uint total = L.sum(s);
+        return (x.a, x.b, total);
+    }
+    function readWithIndirectLibraryCall() public view returns (uint, uint, uint) {
+        S memory x = s;
+        uint total = sumViaInternal();
+        return (x.a, x.b, total);
+    }
+}
+// ----
+// library: L
+// set() ->
+// readWithLibraryCall() -> 1, 2, 3
+// readWithIndirectLibraryCall() -> 1, 2, 3
@@ -0,0 +1,47 @@
+contract C {
+    struct S {
+        uint8 a;
+        uint256 b;
+        uint16[] c;
+        function () internal view returns (uint) f;
+        bytes32 d;
+    }
+    S s;
+    mapping(uint => S) m;
+
+    function g() internal view returns (uint) { return 42; }
+
+    function set() public {
+        s.a = 1;
+        s.b = 2;
+        s.c.push(3);
+        s.f = g;
+        s.d = "abc";
+        m[7].b = 8;
+    }
+    function readMembers() public view returns (uint8, uint256, uint, bytes32) {
+        S memory x = s;
+        return (x.a, x.b, x.f(), x.d);
+    }
+    function readInLoop() public view returns (uint r) {
+        for (uint i = 6; i < 9; i++) {
+            S memory x = m[i];
+            r += x.b;
+        }
+    }
+    function readArrayMember() public view returns (uint) {
+        S memory x = s;
+        return x.b + x.c[0];
+    }
+    function modifyCopy() public view returns (uint, uint) {
+        S memory x = s;
+        x.b = 5;
+        return (x.b, s.b);
+    }
+}
+// ----
+// set() ->
+// readMembers() -> 1, 2, 42, "abc"
+// readInLoop() -> 8
+// readArrayMember() -> 5
+// modifyCopy() -> 5, 2
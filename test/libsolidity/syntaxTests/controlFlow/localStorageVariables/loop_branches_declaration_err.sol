@@ -0,0 +1,35 @@
+contract C {
+    struct S { bool f; }
+    S s;
+    function f(uint n) internal view returns (S storage) {
+        S storage c;
+        for (uint i = 0; i < n; ++i) {
+            if (i == 1) {
+                c = s;
+                break;
+            }
+            else if (i == 2)
+                continue;
+            else if (i == 3)
+                revert();
+        }
+        return c;
+    }
+    function g(uint n) internal view returns (S storage) {
+        S storage c;
+        for (uint i = 0; ; ++i) {
+            if (i == n) {
+                c = s;
+                break;
+            }
+            else if (i == 2)
+                continue;
+            else if (i == 3)
+                revert();
+        }
+        return c;
+    }
+}
+// ----
+// TypeError 3464: (387-388): This variable is of storage pointer type and can be accessed without prior assignment, which would lead to undefined behaviour.
+// TypeError 3464: (731-732): This variable is of storage pointer type and can be accessed without prior assignment, which would lead to undefined behaviour.
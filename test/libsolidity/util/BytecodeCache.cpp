@@ -0,0 +1,97 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <test/libsolidity/util/BytecodeCache.h>
+
+#include <libsolidity/interface/Version.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Keccak256.h>
+
+#include <boost/dll/runtime_symbol_info.hpp>
+
+#include <fstream>
+
+using namespace solidity;
+using namespace solidity::frontend::test;
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+/// @returns a string that changes whenever the running executable is rebuilt.
+std::string const& executableIdentity()
+{
+	static std::string const identity = [] {
+		std::string result = frontend::VersionString;
+		boost::system::error_code error;
+		fs::path executable = boost::dll::program_location(error);
+		if (!error)
+		{
+			result += "\n" + executable.string();
+			result += "\n" + std::to_string(fs::file_size(executable, error));
+			result += "\n" + std::to_string(fs::last_write_time(executable, error));
+		}
+		return result;
+	}();
+	return identity;
+}
+
+}
+
+BytecodeCache::BytecodeCache(fs::path _directory):
+	m_directory(std::move(_directory))
+{
+	fs::create_directories(m_directory);
+}
+
+std::optional<bytes> BytecodeCache::find(std::string const& _key) const
+{
+	fs::path path = entryPath(_key);
+	if (!fs::is_regular_file(path))
+		return std::nullopt;
+	bytes bytecode = util::fromHex(util::readFileAsString(path));
+	if (bytecode.empty())
+		return std::nullopt;
+	return bytecode;
+}
+
+void BytecodeCache::store(std::string const& _key, bytes const& _bytecode) const
+{
+	// Write to a unique temporary file first so that readers never see partial entries.
+	fs::path path = entryPath(_key);
+	fs::path temporaryPath = path;
+	temporaryPath += fs::unique_path(".%%%%-%%%%-%%%%");
+	{
+		std::ofstream file(temporaryPath.string(), std::ios::binary | std::ios::trunc);
+		file << util::toHex(_bytecode);
+		if (!file)
+			return;
+	}
+	boost::system::error_code error;
+	fs::rename(temporaryPath, path, error);
+	if (error)
+		fs::remove(temporaryPath, error);
+}
+
+fs::path BytecodeCache::entryPath(std::string const& _key) const
+{
+	return m_directory / (util::keccak256(executableIdentity() + '\0' + _key).hex() + ".hex");
+}
@@ -0,0 +1,55 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <libsolutil/Common.h>
+
+#include <boost/filesystem.hpp>
+
+#include <optional>
+#include <string>
+
+namespace solidity::frontend::test
+{
+
+/**
+ * On-disk cache of the bytecode of compiled contracts, shared between test runs.
+ *
+ * Entries are looked up by a key that has to describe the sources and all settings
+ * the bytecode depends on (the contract metadata does). The identity of the running
+ * executable is added to every key, so rebuilding the test binary, e.g. after a change
+ * to the compiler, invalidates all entries.
+ *
+ * Entries are written atomically, so the cache can be used by concurrent processes.
+ */
+class BytecodeCache
+{
+public:
+	explicit BytecodeCache(boost::filesystem::path _directory);
+
+	std::optional<bytes> find(std::string const& _key) const;
+	void store(std::string const& _key, bytes const& _bytecode) const;
+
+private:
+	boost::filesystem::path entryPath(std::string const& _key) const;
+
+	boost::filesystem::path m_directory;
+};
+
+}
@@ -0,0 +1,64 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+/// Unit tests for SourceBuffer.
+
+#include <libsolutil/SourceBuffer.h>
+
+#include <liblangutil/CharStream.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <string>
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(SourceBufferTest)
+
+BOOST_AUTO_TEST_CASE(from_string)
+{
+	SourceBuffer buffer("contract C {}");
+	BOOST_TEST(buffer.view() == "contract C {}");
+	BOOST_TEST(buffer.size() == 13);
+}
+
+BOOST_AUTO_TEST_CASE(empty)
+{
+	SourceBuffer buffer("");
+	BOOST_TEST(buffer.view().empty());
+	BOOST_TEST(buffer.size() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(shared_by_char_streams)
+{
+	std::string content = "// comment\ncontract C {}";
+	auto buffer = std::make_shared<SourceBuffer const>(content);
+
+	// The char stream shares the buffer instead of copying it.
+	langutil::CharStream stream(buffer, "a.sol");
+	BOOST_TEST(stream.source().data() == buffer->view().data());
+	langutil::CharStream copy = stream;
+	BOOST_TEST(copy.source().data() == buffer->view().data());
+	BOOST_TEST(copy.size() == content.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
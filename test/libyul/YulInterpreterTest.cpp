@@ -18,6 +18,7 @@
 
 #include <test/libyul/YulInterpreterTest.h>
 
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
 #include <test/tools/yulInterpreter/Interpreter.h>
 
 #include <test/Common.h>
@@ -89,6 +90,16 @@ bool YulInterpreterTest::parse(ostream& _stream, string const& _linePrefix, bool
 }
 
 string YulInterpreterTest::interpret()
+{
+	string const result = interpret(&Interpreter::run);
+	// The fuzzers use the compiled interpreter, so it has to behave exactly the same.
+	string const compiledResult = interpret(&CompiledInterpreter::run);
+	if (compiledResult != result)
+		return result + "Result of the compiled interpreter differs:\n" + compiledResult;
+	return result;
+}
+
+string YulInterpreterTest::interpret(void (*_run)(InterpreterState&, Dialect const&, Block const&, bool, bool))
 {
 	InterpreterState state;
 	state.maxTraceSize = 32;
@@ -96,7 +107,7 @@ string YulInterpreterTest::interpret()
 	state.maxExprNesting = 64;
 	try
 	{
-		Interpreter::run(
+		_run(
 			state,
 			EVMDialect::strictAssemblyForEVMObjects(solidity::test::CommonOptions::get().evmVersion()),
 			*m_ast,
@@ -24,11 +24,14 @@ namespace solidity::yul
 {
 struct AsmAnalysisInfo;
 struct Block;
+struct Dialect;
 }
 
 namespace solidity::yul::test
 {
 
+struct InterpreterState;
+
 class YulInterpreterTest: public solidity::frontend::test::EVMVersionRestrictedTestCase
 {
 public:
@@ -43,7 +46,11 @@ public:
 
 private:
 	bool parse(std::ostream& _stream, std::string const& _linePrefix, bool const _formatted);
+	/// Runs the code with both Interpreter and CompiledInterpreter.
+	/// @returns the resulting trace and state, extended by the result of
+	/// CompiledInterpreter if that differs.
 	std::string interpret();
+	std::string interpret(void (*_run)(InterpreterState&, Dialect const&, Block const&, bool, bool));
 
 	std::shared_ptr<Block> m_ast;
 	std::shared_ptr<AsmAnalysisInfo> m_analysisInfo;
@@ -69,7 +69,14 @@ void IsolTestOptions::addOptions()
 		("help", po::bool_switch(&showHelp)->default_value(showHelp), "Show this help screen.")
 		("no-color", po::bool_switch(&noColor)->default_value(noColor), "Don't use colors.")
 		("accept-updates", po::bool_switch(&acceptUpdates)->default_value(acceptUpdates), "Automatically accept expectation updates.")
-		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.");
+		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.")
+		(
+			"jobs,j",
+			po::value<size_t>(&jobs)->default_value(jobs),
+			"Number of worker processes used to run the tests of a suite in parallel. "
+			"Results are reported in the same order as when running sequentially and "
+			"failing tests are re-run in the main process for interactive updates."
+		);
 }
 
 bool IsolTestOptions::parse(int _argc, char const* const* _argv)
@@ -97,6 +104,10 @@ void IsolTestOptions::validate() const
 		ConfigException,
 		"Invalid test unit filter - can only contain '" + filterString + ": " + testFilter
 	);
+	assertThrow(jobs > 0, ConfigException, "Number of jobs must be positive.");
+#if defined(_WIN32)
+	assertThrow(jobs == 1, ConfigException, "Running tests in parallel is not supported on Windows.");
+#endif
 }
 
 }
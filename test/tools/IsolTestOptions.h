@@ -34,6 +34,8 @@ struct IsolTestOptions: CommonOptions
 	bool acceptUpdates = false;
 	std::string testFilter = std::string{};
 	std::string editor = std::string{};
+	/// Number of worker processes the test files of a suite are distributed to.
+	size_t jobs = 1;
 
 	explicit IsolTestOptions();
 	void addOptions() override;
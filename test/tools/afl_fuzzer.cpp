@@ -34,6 +34,10 @@ using namespace solidity::util;
 
 namespace po = boost::program_options;
 
+#ifdef __AFL_FUZZ_TESTCASE_LEN
+__AFL_FUZZ_INIT();
+#endif
+
 int main(int argc, char** argv)
 {
 	po::options_description options(
@@ -110,6 +114,29 @@ Allowed options)",
 	bool optimize = !arguments.count("without-optimizer");
 	int retResult = 0;
 
+	auto testInput = [&](string const& _input) {
+		if (arguments.count("const-opt"))
+			FuzzerUtil::testConstantOptimizer(_input, quiet);
+		else if (arguments.count("standard-json"))
+			FuzzerUtil::testStandardCompiler(_input, quiet);
+		else
+			FuzzerUtil::testCompilerJsonInterface(_input, optimize, quiet);
+	};
+
+#ifdef __AFL_FUZZ_TESTCASE_LEN
+	// Built with an AFL++ compiler: When reading from stdin, run in persistent mode,
+	// i.e. take the inputs from AFL's shared memory and test them in a loop without
+	// restarting the process for every input.
+	if (inputs == vector<string>{""})
+	{
+		__AFL_INIT();
+		unsigned char const* buffer = __AFL_FUZZ_TESTCASE_BUF;
+		while (__AFL_LOOP(10000))
+			testInput(string(reinterpret_cast<char const*>(buffer), static_cast<size_t>(__AFL_FUZZ_TESTCASE_LEN)));
+		return 0;
+	}
+#endif
+
 	for (string const& inputFile: inputs)
 	{
 		string input;
@@ -120,12 +147,7 @@ Allowed options)",
 
 		try
 		{
-			if (arguments.count("const-opt"))
-				FuzzerUtil::testConstantOptimizer(input, quiet);
-			else if (arguments.count("standard-json"))
-				FuzzerUtil::testStandardCompiler(input, quiet);
-			else
-				FuzzerUtil::testCompilerJsonInterface(input, optimize, quiet);
+			testInput(input);
 		}
 		catch (...)
 		{
@@ -24,6 +24,8 @@
 
 #include <libsolutil/JSON.h>
 
+#include <libyul/YulString.h>
+
 #include <libevmasm/Assembly.h>
 #include <libevmasm/ConstantOptimiser.h>
 
@@ -40,6 +42,8 @@ using namespace solidity::frontend;
 using namespace solidity::langutil;
 using namespace solidity::util;
 
+static size_t constexpr c_maxPersistentYulStrings = 100000;
+
 static vector<EVMVersion> s_evmVersions = {
 	EVMVersion::homestead(),
 	EVMVersion::tangerineWhistle(),
@@ -94,7 +98,18 @@ void FuzzerUtil::testCompiler(
 	bool _compileViaYul
 )
 {
-	frontend::CompilerStack compiler;
+	// The compiler stack is reused across inputs so that persistent fuzzing
+	// (libFuzzer, AFL++ persistent mode) does not pay for constructing it per input.
+	// It is intentionally leaked: destroying it at exit would reset TypeProvider,
+	// which may already have been destroyed by then.
+	static frontend::CompilerStack* persistentCompiler = new frontend::CompilerStack();
+	frontend::CompilerStack& compiler = *persistentCompiler;
+	compiler.reset();
+	// Nothing refers to the Yul strings of previous inputs after the reset, but clearing
+	// the repository also clears the cached dialects, so only do it once it has grown large.
+	if (yul::YulStringRepository::instance().size() > c_maxPersistentYulStrings)
+		yul::YulStringRepository::reset();
+
 	EVMVersion evmVersion = s_evmVersions[_rand % s_evmVersions.size()];
 	frontend::OptimiserSettings optimiserSettings;
 	if (_optimize)
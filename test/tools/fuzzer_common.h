@@ -37,6 +37,8 @@ struct FuzzerUtil
 	/// version to be compiled for, and bool @param _forceSMT that, if true,
 	/// adds the experimental SMTChecker pragma to each source file in the
 	/// source map.
+	/// The same compiler stack is reused for all calls, so no other
+	/// CompilerStack may exist while this function is used.
 	static void testCompiler(
 		solidity::StringMap& _input,
 		bool _optimize,
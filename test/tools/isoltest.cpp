@@ -27,15 +27,24 @@
 
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/throw_exception.hpp>
 
+#include <atomic>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <new>
 #include <queue>
 #include <regex>
+#include <sstream>
 #include <utility>
 
 #if defined(_WIN32)
 #include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #endif
 
 using namespace std;
@@ -133,6 +142,16 @@ private:
 	void updateTestCase();
 	Request handleResponse(bool _exception);
 
+	/// Runs the given test files in _options.jobs worker processes and
+	/// @returns the result of each file together with the output it produced.
+	/// Files whose worker terminated abnormally are reported as exceptions.
+	static vector<pair<Result, string>> processInWorkers(
+		TestCreator _testCaseCreator,
+		TestOptions const& _options,
+		fs::path const& _basepath,
+		vector<fs::path> const& _testFiles
+	);
+
 	TestCreator m_testCaseCreator;
 	TestOptions const& m_options;
 	TestFilter m_filter;
@@ -265,6 +284,95 @@ TestTool::Request TestTool::handleResponse(bool _exception)
 	}
 }
 
+#if !defined(_WIN32)
+vector<pair<TestTool::Result, string>> TestTool::processInWorkers(
+	TestCreator _testCaseCreator,
+	TestOptions const& _options,
+	fs::path const& _basepath,
+	vector<fs::path> const& _testFiles
+)
+{
+	// Workers are processes rather than threads because the compiler keeps process-wide state
+	// (type and string repositories, dialect caches) that is not safe to share between threads.
+	// The index of the next test file is shared between the workers, so that the load is balanced.
+	void* sharedMemory = mmap(nullptr, sizeof(atomic<size_t>), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (sharedMemory == MAP_FAILED)
+		BOOST_THROW_EXCEPTION(runtime_error("Could not allocate memory shared by the worker processes."));
+	auto* nextTest = new (sharedMemory) atomic<size_t>(0);
+
+	// Output written to cout before forking would otherwise be written again by every worker.
+	cout.flush();
+
+	vector<fs::path> resultFiles;
+	vector<pid_t> workers;
+	for (size_t worker = 0; worker < _options.jobs; ++worker)
+	{
+		resultFiles.emplace_back(fs::temp_directory_path() / fs::unique_path("isoltest-%%%%-%%%%-%%%%-%%%%"));
+		pid_t pid = fork();
+		if (pid < 0)
+			BOOST_THROW_EXCEPTION(runtime_error("Could not start a worker process."));
+		if (pid == 0)
+		{
+			ofstream resultFile(resultFiles.back().string(), ios::binary);
+			for (size_t index = (*nextTest)++; index < _testFiles.size(); index = (*nextTest)++)
+			{
+				ostringstream output;
+				streambuf* originalBuffer = cout.rdbuf(output.rdbuf());
+				Result result = TestTool(
+					_testCaseCreator,
+					_options,
+					_basepath / _testFiles[index],
+					_testFiles[index].generic_path().string()
+				).process();
+				cout.rdbuf(originalBuffer);
+				resultFile << index << " " << static_cast<int>(result) << " " << output.str().size() << "\n" << output.str();
+				resultFile.flush();
+			}
+			resultFile.close();
+			// Skip static destructors and atexit handlers, they belong to the parent process.
+			_exit(resultFile ? EXIT_SUCCESS : EXIT_FAILURE);
+		}
+		workers.push_back(pid);
+	}
+
+	for (pid_t pid: workers)
+		waitpid(pid, nullptr, 0);
+	munmap(sharedMemory, sizeof(atomic<size_t>));
+
+	vector<pair<Result, string>> results(
+		_testFiles.size(),
+		{Result::Exception, "Worker process terminated unexpectedly.\n"}
+	);
+	for (fs::path const& resultFilePath: resultFiles)
+	{
+		ifstream resultFile(resultFilePath.string(), ios::binary);
+		size_t index = 0;
+		int result = 0;
+		size_t outputSize = 0;
+		while (resultFile >> index >> result >> outputSize && resultFile.get() == '\n' && index < results.size())
+		{
+			string output(outputSize, '\0');
+			if (!resultFile.read(output.data(), static_cast<streamsize>(outputSize)))
+				break;
+			results[index] = {static_cast<Result>(result), std::move(output)};
+		}
+		resultFile.close();
+		fs::remove(resultFilePath);
+	}
+	return results;
+}
+#else
+vector<pair<TestTool::Result, string>> TestTool::processInWorkers(
+	TestCreator,
+	TestOptions const&,
+	fs::path const&,
+	vector<fs::path> const&
+)
+{
+	BOOST_THROW_EXCEPTION(runtime_error("Parallel test execution is not supported on this platform."));
+}
+#endif
+
 TestStats TestTool::processPath(
 	TestCreator _testCaseCreator,
 	TestOptions const& _options,
@@ -279,14 +387,15 @@ TestStats TestTool::processPath(
 	int testCount = 0;
 	int skippedCount = 0;
 
+	vector<fs::path> testFiles;
 	while (!paths.empty())
 	{
 		auto currentPath = paths.front();
+		paths.pop();
 
 		fs::path fullpath = _basepath / currentPath;
 		if (fs::is_directory(fullpath))
 		{
-			paths.pop();
 			for (auto const& entry: boost::iterator_range<fs::directory_iterator>(
 				fs::directory_iterator(fullpath),
 				fs::directory_iterator()
@@ -295,56 +404,75 @@ TestStats TestTool::processPath(
 					paths.push(currentPath / entry.path().filename());
 		}
 		else if (m_exitRequested)
-		{
 			++testCount;
-			paths.pop();
-		}
 		else if (!_batcher.checkAndAdvance())
-		{
-			paths.pop();
 			++skippedCount;
-		}
 		else
+			testFiles.push_back(currentPath);
+	}
+
+	// With multiple jobs, all test files are processed by worker processes first. Their output is
+	// then printed in the same order as in sequential mode. Failing tests are run again by this
+	// process to allow interactive updates.
+	vector<pair<Result, string>> workerResults;
+	if (_options.jobs > 1 && !testFiles.empty())
+		workerResults = processInWorkers(_testCaseCreator, _options, _basepath, testFiles);
+
+	for (size_t index = 0; index < testFiles.size(); ++index)
+	{
+		++testCount;
+		if (m_exitRequested)
+			continue;
+
+		TestTool testTool(
+			_testCaseCreator,
+			_options,
+			_basepath / testFiles[index],
+			testFiles[index].generic_path().string()
+		);
+		optional<Result> result;
+		if (!workerResults.empty())
 		{
-			++testCount;
-			TestTool testTool(
-				_testCaseCreator,
-				_options,
-				fullpath,
-				currentPath.generic_path().string()
-			);
-			auto result = testTool.process();
+			auto const& [workerResult, output] = workerResults[index];
+			if (workerResult == Result::Success || workerResult == Result::Skipped)
+			{
+				cout << output;
+				result = workerResult;
+			}
+		}
+		if (!result)
+			result = testTool.process();
 
-			switch(result)
+		while (result)
+			switch(*result)
 			{
 			case Result::Failure:
 			case Result::Exception:
-				switch(testTool.handleResponse(result == Result::Exception))
+				switch(testTool.handleResponse(*result == Result::Exception))
 				{
 				case Request::Quit:
-					paths.pop();
 					m_exitRequested = true;
+					result.reset();
 					break;
 				case Request::Rerun:
 					cout << "Re-running test case..." << endl;
-					--testCount;
+					result = testTool.process();
 					break;
 				case Request::Skip:
-					paths.pop();
 					++skippedCount;
+					result.reset();
 					break;
 				}
 				break;
 			case Result::Success:
-				paths.pop();
 				++successCount;
+				result.reset();
 				break;
 			case Result::Skipped:
-				paths.pop();
 				++skippedCount;
+				result.reset();
 				break;
 			}
-		}
 	}
 
 	return { successCount, testCount, skippedCount };
@@ -0,0 +1,715 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Yul interpreter operating on a pre-resolved form of the AST.
+ */
+
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
+
+#include <test/tools/yulInterpreter/EVMInstructionInterpreter.h>
+
+#include <libyul/AST.h>
+#include <libyul/Dialect.h>
+#include <libyul/Utilities.h>
+#include <libyul/backends/evm/EVMDialect.h>
+
+#include <libevmasm/Instruction.h>
+
+#include <deque>
+#include <map>
+#include <optional>
+#include <vector>
+
+using namespace solidity;
+using namespace solidity::yul;
+using namespace solidity::yul::test;
+
+namespace
+{
+
+struct CompiledFunction;
+struct CompiledStatement;
+
+struct CompiledExpression
+{
+	enum class Kind
+	{
+		Literal,
+		/// Literal argument of a builtin, which is not evaluated as an expression.
+		LiteralArgument,
+		Variable,
+		BuiltinCall,
+		FunctionCall
+	};
+
+	Kind kind = Kind::Literal;
+	/// Value of literals.
+	u256 value;
+	/// Frame slot of variables.
+	size_t slot = 0;
+	BuiltinFunctionForEVM const* builtin = nullptr;
+	/// Arguments of builtin calls as they appear in the AST, needed for builtins with literal arguments.
+	std::vector<Expression> const* builtinArguments = nullptr;
+	/// True for builtins that call other contracts, which might have to be simulated.
+	bool externalCall = false;
+	CompiledFunction const* function = nullptr;
+	std::vector<CompiledExpression> arguments;
+};
+
+struct CompiledBlock
+{
+	std::vector<CompiledStatement> statements;
+};
+
+struct CompiledCase
+{
+	/// Not set for the default case.
+	std::optional<u256> value;
+	CompiledBlock body;
+};
+
+struct CompiledStatement
+{
+	enum class Kind
+	{
+		Expression,
+		Assignment,
+		VariableDeclaration,
+		FunctionDefinition,
+		If,
+		Switch,
+		ForLoop,
+		Break,
+		Continue,
+		Leave,
+		Block
+	};
+
+	Kind kind = Kind::Expression;
+	/// Expression of expression statements and switches, value of assignments and variable
+	/// declarations and condition of if statements and for loops.
+	std::optional<CompiledExpression> expression;
+	/// Frame slots of the assigned or declared variables.
+	std::vector<size_t> slots;
+	/// Body of if statements, for loops and blocks.
+	CompiledBlock body;
+	CompiledBlock pre;
+	CompiledBlock post;
+	std::vector<CompiledCase> cases;
+};
+
+struct CompiledFunction
+{
+	size_t parameterCount = 0;
+	size_t returnVariableCount = 0;
+	/// Number of slots needed for parameters, return variables and local variables.
+	/// Parameters occupy the first slots, followed by the return variables.
+	size_t frameSize = 0;
+	CompiledBlock body;
+};
+
+struct CompiledProgram
+{
+	/// Calls refer to functions by pointer, so they must not be moved.
+	std::deque<CompiledFunction> functions;
+	CompiledBlock code;
+	/// Number of slots needed for the variables outside of functions.
+	size_t frameSize = 0;
+	langutil::EVMVersion evmVersion;
+};
+
+/**
+ * Resolves all names of a Yul AST and translates it into a CompiledProgram.
+ */
+class ProgramCompiler
+{
+public:
+	ProgramCompiler(Dialect const& _dialect, CompiledProgram& _program):
+		m_dialect(_dialect),
+		m_evmDialect(dynamic_cast<EVMDialect const*>(&_dialect)),
+		m_program(_program)
+	{
+		if (m_evmDialect)
+			m_program.evmVersion = m_evmDialect->evmVersion();
+	}
+
+	void run(Block const& _ast)
+	{
+		m_program.code = compileBlock(_ast);
+		m_program.frameSize = m_frameSize;
+	}
+
+private:
+	static CompiledStatement makeStatement(CompiledStatement::Kind _kind)
+	{
+		CompiledStatement statement;
+		statement.kind = _kind;
+		return statement;
+	}
+
+	CompiledBlock compileBlock(Block const& _block)
+	{
+		m_variableScopes.emplace_back();
+		m_functionScopes.emplace_back();
+		CompiledBlock block = compileStatements(_block);
+		m_functionScopes.pop_back();
+		m_variableScopes.pop_back();
+		return block;
+	}
+
+	/// Compiles the statements of @a _block in the current scope.
+	CompiledBlock compileStatements(Block const& _block)
+	{
+		// Functions can be called before their definition.
+		for (Statement const& statement: _block.statements)
+			if (auto const* function = std::get_if<FunctionDefinition>(&statement))
+				m_functionScopes.back()[function->name] = &m_program.functions.emplace_back();
+
+		CompiledBlock block;
+		block.statements.reserve(_block.statements.size());
+		for (Statement const& statement: _block.statements)
+			block.statements.emplace_back(std::visit([&](auto const& _statement) { return compile(_statement); }, statement));
+		return block;
+	}
+
+	CompiledStatement compile(ExpressionStatement const& _statement)
+	{
+		CompiledStatement statement = makeStatement(CompiledStatement::Kind::Expression);
+		statement.expression = compile(_statement.expression);
+		return statement;
+	}
+
+	CompiledStatement compile(Assignment const& _assignment)
+	{
+		yulAssert(_assignment.value);
+		CompiledStatement statement = makeStatement(CompiledStatement::Kind::Assignment);
+		statement.expression = compile(*_assignment.value);
+		for (Identifier const& variable: _assignment.variableNames)
+			statement.slots.emplace_back(slotOf(variable.name));
+		return statement;
+	}
+
+	CompiledStatement compile(VariableDeclaration const& _declaration)
+	{
+		CompiledStatement statement = makeStatement(CompiledStatement::Kind::VariableDeclaration);
+		if (_declaration.value)
+			statement.expression = compile(*_declaration.value);
+		for (TypedName const& variable: _declaration.variables)
+			statement.slots.emplace_back(declare(variable.name));
+		return statement;
+	}
+
+	CompiledStatement compile(FunctionDefinition const& _definition)
+	{
+		CompiledFunction& function = *m_functionScopes.back().at(_definition.name);
+
+		// Functions cannot access variables of enclosing scopes and have their own frame.
+		std::vector<std::map<YulString, size_t>> outerVariableScopes;
+		std::swap(outerVariableScopes, m_variableScopes);
+		size_t const outerFrameSize = m_frameSize;
+		m_variableScopes.emplace_back();
+		m_frameSize = 0;
+
+		for (TypedName const& parameter: _definition.parameters)
+			declare(parameter.name);
+		for (TypedName const& returnVariable: _definition.returnVariables)
+			declare(returnVariable.name);
+		function.parameterCount = _definition.parameters.size();
+		function.returnVariableCount = _definition.returnVariables.size();
+		function.body = compileBlock(_definition.body);
+		function.frameSize = m_frameSize;
+
+		m_variableScopes = std::move(outerVariableScopes);
+		m_frameSize = outerFrameSize;
+		return makeStatement(CompiledStatement::Kind::FunctionDefinition);
+	}
+
+	CompiledStatement compile(If const& _if)
+	{
+		yulAssert(_if.condition);
+		CompiledStatement statement = makeStatement(CompiledStatement::Kind::If);
+		statement.expression = compile(*_if.condition);
+		statement.body = compileBlock(_if.body);
+		return statement;
+	}
+
+	CompiledStatement compile(Switch const& _switch)
+	{
+		yulAssert(_switch.expression);
+		yulAssert(!_switch.cases.empty());
+		CompiledStatement statement = makeStatement(CompiledStatement::Kind::Switch);
+		statement.expression = compile(*_switch.expression);
+		for (Case const& switchCase: _switch.cases)
+		{
+			std::optional<u256> value;
+			if (switchCase.value)
+				value = valueOfLiteral(*switchCase.value);
+			statement.cases.emplace_back(CompiledCase{value, compileBlock(switchCase.body)});
+		}
+		return statement;
+	}
+
+	CompiledStatement compile(ForLoop const& _forLoop)
+	{
+		yulAssert(_forLoop.condition);
+		CompiledStatement statement = makeStatement(CompiledStatement::Kind::ForLoop);
+		// Variables declared in the pre block are visible in all other parts of the loop.
+		m_variableScopes.emplace_back();
+		m_functionScopes.emplace_back();
+		statement.pre = compileStatements(_forLoop.pre);
+		statement.expression = compile(*_forLoop.condition);
+		statement.body = compileBlock(_forLoop.body);
+		statement.post = compileBlock(_forLoop.post);
+		m_functionScopes.pop_back();
+		m_variableScopes.pop_back();
+		return statement;
+	}
+
+	CompiledStatement compile(Break const&) { return makeStatement(CompiledStatement::Kind::Break); }
+	CompiledStatement compile(Continue const&) { return makeStatement(CompiledStatement::Kind::Continue); }
+	CompiledStatement compile(Leave const&) { return makeStatement(CompiledStatement::Kind::Leave); }
+
+	CompiledStatement compile(Block const& _block)
+	{
+		CompiledStatement statement = makeStatement(CompiledStatement::Kind::Block);
+		statement.body = compileBlock(_block);
+		return statement;
+	}
+
+	CompiledExpression compile(Expression const& _expression)
+	{
+		return std::visit([&](auto const& _node) { return compile(_node); }, _expression);
+	}
+
+	CompiledExpression compile(Literal const& _literal)
+	{
+		CompiledExpression expression;
+		expression.kind = CompiledExpression::Kind::Literal;
+		expression.value = valueOfLiteral(_literal);
+		return expression;
+	}
+
+	CompiledExpression compile(Identifier const& _identifier)
+	{
+		CompiledExpression expression;
+		expression.kind = CompiledExpression::Kind::Variable;
+		expression.slot = slotOf(_identifier.name);
+		return expression;
+	}
+
+	CompiledExpression compile(FunctionCall const& _call)
+	{
+		YulString const name = _call.functionName.name;
+		CompiledExpression expression;
+		if (BuiltinFunctionForEVM const* builtin = m_evmDialect ? m_evmDialect->builtin(name) : nullptr)
+		{
+			expression.kind = CompiledExpression::Kind::BuiltinCall;
+			expression.builtin = builtin;
+			expression.builtinArguments = &_call.arguments;
+			expression.externalCall = builtin->instruction && evmasm::isCallInstruction(*builtin->instruction);
+		}
+		else
+		{
+			expression.kind = CompiledExpression::Kind::FunctionCall;
+			for (auto scope = m_functionScopes.rbegin(); scope != m_functionScopes.rend() && !expression.function; ++scope)
+				if (auto function = scope->find(name); function != scope->end())
+					expression.function = function->second;
+			yulAssert(expression.function, "Function not found.");
+		}
+
+		BuiltinFunction const* builtin = m_dialect.builtin(name);
+		for (size_t i = 0; i < _call.arguments.size(); ++i)
+			if (builtin && builtin->literalArgument(i))
+			{
+				// Same conversion as in ExpressionEvaluator::evaluateArgs().
+				CompiledExpression argument;
+				argument.kind = CompiledExpression::Kind::LiteralArgument;
+				try
+				{
+					argument.value = u256(std::get<Literal>(_call.arguments[i]).value.str());
+				}
+				catch (std::exception&)
+				{
+					argument.value = 0;
+				}
+				expression.arguments.emplace_back(std::move(argument));
+			}
+			else
+				expression.arguments.emplace_back(compile(_call.arguments[i]));
+		return expression;
+	}
+
+	size_t declare(YulString _name)
+	{
+		size_t const slot = m_frameSize++;
+		m_variableScopes.back()[_name] = slot;
+		return slot;
+	}
+
+	size_t slotOf(YulString _name) const
+	{
+		for (auto scope = m_variableScopes.rbegin(); scope != m_variableScopes.rend(); ++scope)
+			if (auto variable = scope->find(_name); variable != scope->end())
+				return variable->second;
+		yulAssert(false, "Variable not found.");
+		return 0;
+	}
+
+	Dialect const& m_dialect;
+	EVMDialect const* m_evmDialect = nullptr;
+	CompiledProgram& m_program;
+	/// Variables visible at the current position, innermost scope last.
+	std::vector<std::map<YulString, size_t>> m_variableScopes;
+	/// Functions visible at the current position, innermost scope last.
+	std::vector<std::map<YulString, CompiledFunction*>> m_functionScopes;
+	/// Number of slots used so far by the current function.
+	size_t m_frameSize = 0;
+};
+
+/**
+ * Executes a CompiledProgram. Steps and expression nesting are counted at the same points
+ * as in Interpreter and ExpressionEvaluator.
+ */
+class ProgramRunner
+{
+public:
+	ProgramRunner(
+		InterpreterState& _state,
+		CompiledProgram const& _program,
+		bool _disableExternalCalls,
+		bool _disableMemoryTrace
+	):
+		m_state(_state),
+		m_program(_program),
+		m_instructions(_program.evmVersion, _state, _disableMemoryTrace),
+		m_disableExternalCalls(_disableExternalCalls),
+		m_disableMemoryTrace(_disableMemoryTrace)
+	{}
+
+	void run()
+	{
+		m_stack.assign(m_program.frameSize, 0);
+		m_frameBase = 0;
+		execute(m_program.code);
+	}
+
+private:
+	ControlFlowState execute(CompiledBlock const& _block)
+	{
+		for (CompiledStatement const& statement: _block.statements)
+		{
+			incrementStep();
+			ControlFlowState const flow = execute(statement);
+			if (flow != ControlFlowState::Default)
+				return flow;
+		}
+		return ControlFlowState::Default;
+	}
+
+	ControlFlowState execute(CompiledStatement const& _statement)
+	{
+		using Kind = CompiledStatement::Kind;
+		switch (_statement.kind)
+		{
+		case Kind::Expression:
+			m_nestingLevel = 0;
+			if (_statement.expression->kind == CompiledExpression::Kind::FunctionCall)
+				callFunction(*_statement.expression);
+			else
+				evaluate(*_statement.expression);
+			break;
+		case Kind::Assignment:
+			assign(*_statement.expression, _statement.slots);
+			break;
+		case Kind::VariableDeclaration:
+			if (_statement.expression)
+				assign(*_statement.expression, _statement.slots);
+			else
+				for (size_t slot: _statement.slots)
+					variable(slot) = 0;
+			break;
+		case Kind::FunctionDefinition:
+			break;
+		case Kind::If:
+			if (evaluateCondition(*_statement.expression))
+				return execute(_statement.body);
+			break;
+		case Kind::Switch:
+		{
+			m_nestingLevel = 0;
+			u256 const value = evaluate(*_statement.expression);
+			for (CompiledCase const& switchCase: _statement.cases)
+				if (!switchCase.value || *switchCase.value == value)
+					return execute(switchCase.body);
+			break;
+		}
+		case Kind::ForLoop:
+			return executeForLoop(_statement);
+		case Kind::Break:
+			return ControlFlowState::Break;
+		case Kind::Continue:
+			return ControlFlowState::Continue;
+		case Kind::Leave:
+			return ControlFlowState::Leave;
+		case Kind::Block:
+			return execute(_statement.body);
+		}
+		return ControlFlowState::Default;
+	}
+
+	ControlFlowState executeForLoop(CompiledStatement const& _forLoop)
+	{
+		// The statements of the pre block do not count as steps.
+		for (CompiledStatement const& statement: _forLoop.pre.statements)
+			if (execute(statement) == ControlFlowState::Leave)
+				return ControlFlowState::Leave;
+
+		bool const empty = _forLoop.body.statements.empty() && _forLoop.post.statements.empty();
+		while (evaluateCondition(*_forLoop.expression))
+		{
+			// Count iterations of loops without statements to prevent a deadlock.
+			if (empty)
+				incrementStep();
+
+			ControlFlowState const flow = execute(_forLoop.body);
+			if (flow == ControlFlowState::Break)
+				break;
+			if (flow == ControlFlowState::Leave || execute(_forLoop.post) == ControlFlowState::Leave)
+				return ControlFlowState::Leave;
+		}
+		return ControlFlowState::Default;
+	}
+
+	bool evaluateCondition(CompiledExpression const& _condition)
+	{
+		m_nestingLevel = 0;
+		return evaluate(_condition) != 0;
+	}
+
+	/// Evaluates @a _value, which is not part of another expression, and assigns its values
+	/// to the variables at @a _slots.
+	void assign(CompiledExpression const& _value, std::vector<size_t> const& _slots)
+	{
+		m_nestingLevel = 0;
+		if (_value.kind == CompiledExpression::Kind::FunctionCall)
+		{
+			callFunction(_value);
+			yulAssert(m_returnValues.size() == _slots.size());
+			for (size_t i = 0; i < _slots.size(); ++i)
+				variable(_slots[i]) = m_returnValues[i];
+		}
+		else
+		{
+			yulAssert(_slots.size() == 1);
+			u256 const value = evaluate(_value);
+			variable(_slots.front()) = value;
+		}
+	}
+
+	u256 evaluate(CompiledExpression const& _expression)
+	{
+		switch (_expression.kind)
+		{
+		case CompiledExpression::Kind::Literal:
+			incrementNesting();
+			return _expression.value;
+		case CompiledExpression::Kind::LiteralArgument:
+			return _expression.value;
+		case CompiledExpression::Kind::Variable:
+			incrementNesting();
+			return variable(_expression.slot);
+		case CompiledExpression::Kind::BuiltinCall:
+			return callBuiltin(_expression);
+		case CompiledExpression::Kind::FunctionCall:
+			callFunction(_expression);
+			yulAssert(m_returnValues.size() == 1);
+			return m_returnValues.front();
+		}
+		yulAssert(false);
+		return 0;
+	}
+
+	/// Evaluates the arguments of @a _call from right to left into a buffer that stays
+	/// valid until m_argumentDepth is decremented again.
+	std::vector<u256> const& evaluateArguments(CompiledExpression const& _call)
+	{
+		incrementNesting();
+		if (m_argumentDepth == m_argumentBuffers.size())
+			m_argumentBuffers.emplace_back();
+		std::vector<u256>& arguments = m_argumentBuffers[m_argumentDepth++];
+		arguments.resize(_call.arguments.size());
+		for (size_t i = _call.arguments.size(); i-- > 0;)
+			arguments[i] = evaluate(_call.arguments[i]);
+		return arguments;
+	}
+
+	u256 callBuiltin(CompiledExpression const& _call)
+	{
+		std::vector<u256> const& arguments = evaluateArguments(_call);
+		BuiltinFunctionForEVM const& builtin = *_call.builtin;
+		u256 const value =
+			builtin.instruction ?
+			m_instructions.eval(*builtin.instruction, arguments) :
+			m_instructions.evalBuiltin(builtin, *_call.builtinArguments, arguments);
+		if (_call.externalCall && !m_disableExternalCalls)
+			runExternalCall(*builtin.instruction, arguments);
+		--m_argumentDepth;
+		return value;
+	}
+
+	/// Calls the function and stores its return values in m_returnValues.
+	void callFunction(CompiledExpression const& _call)
+	{
+		CompiledFunction const& function = *_call.function;
+		std::vector<u256> const& arguments = evaluateArguments(_call);
+		yulAssert(arguments.size() == function.parameterCount);
+
+		size_t const callerFrameBase = m_frameBase;
+		size_t const callerNestingLevel = m_nestingLevel;
+		m_frameBase = m_stack.size();
+		m_stack.resize(m_frameBase + function.frameSize);
+		std::copy(arguments.begin(), arguments.end(), m_stack.begin() + static_cast<ptrdiff_t>(m_frameBase));
+		--m_argumentDepth;
+
+		execute(function.body);
+
+		auto const returnVariables = m_stack.begin() + static_cast<ptrdiff_t>(m_frameBase + function.parameterCount);
+		m_returnValues.assign(returnVariables, returnVariables + static_cast<ptrdiff_t>(function.returnVariableCount));
+		m_stack.resize(m_frameBase);
+		m_frameBase = callerFrameBase;
+		m_nestingLevel = callerNestingLevel;
+	}
+
+	/// Same as ExpressionEvaluator::runExternalCall().
+	void runExternalCall(evmasm::Instruction _instruction, std::vector<u256> const& _arguments)
+	{
+		u256 memOutOffset = 0;
+		u256 memOutSize = 0;
+		u256 callvalue = 0;
+		u256 memInOffset = 0;
+		u256 memInSize = 0;
+
+		if (
+			_instruction == evmasm::Instruction::CALL ||
+			_instruction == evmasm::Instruction::CALLCODE
+		)
+		{
+			memOutOffset = _arguments[5];
+			memOutSize = _arguments[6];
+			callvalue = _arguments[2];
+			memInOffset = _arguments[3];
+			memInSize = _arguments[4];
+		}
+		else if (
+			_instruction == evmasm::Instruction::DELEGATECALL ||
+			_instruction == evmasm::Instruction::STATICCALL
+		)
+		{
+			memOutOffset = _arguments[4];
+			memOutSize = _arguments[5];
+			memInOffset = _arguments[2];
+			memInSize = _arguments[3];
+		}
+		else
+			yulAssert(false);
+
+		// Don't execute external call if it isn't our own address
+		if (_arguments[1] != util::h160::Arith(m_state.address))
+			return;
+
+		InterpreterState calleeState;
+		calleeState.calldata = m_state.readMemory(memInOffset, memInSize);
+		calleeState.callvalue = callvalue;
+		calleeState.numInstance = m_state.numInstance + 1;
+
+		yulAssert(calleeState.numInstance < 1024, "Detected more than 1024 recursive calls, aborting...");
+
+		try
+		{
+			ProgramRunner{calleeState, m_program, m_disableExternalCalls, m_disableMemoryTrace}.run();
+		}
+		catch (ExplicitlyTerminatedWithReturn const&)
+		{
+			// Copy return data to our memory
+			copyZeroExtended(
+				m_state.memory,
+				calleeState.returndata,
+				memOutOffset.convert_to<size_t>(),
+				0,
+				memOutSize.convert_to<size_t>()
+			);
+			m_state.returndata = calleeState.returndata;
+		}
+	}
+
+	u256& variable(size_t _slot) { return m_stack[m_frameBase + _slot]; }
+
+	void incrementStep()
+	{
+		m_state.numSteps++;
+		if (m_state.maxSteps > 0 && m_state.numSteps >= m_state.maxSteps)
+		{
+			m_state.trace.emplace_back("Interpreter execution step limit reached.");
+			BOOST_THROW_EXCEPTION(StepLimitReached());
+		}
+	}
+
+	void incrementNesting()
+	{
+		m_nestingLevel++;
+		if (m_state.maxExprNesting > 0 && m_nestingLevel > m_state.maxExprNesting)
+		{
+			m_state.trace.emplace_back("Maximum expression nesting level reached.");
+			BOOST_THROW_EXCEPTION(ExpressionNestingLimitReached());
+		}
+	}
+
+	InterpreterState& m_state;
+	CompiledProgram const& m_program;
+	EVMInstructionInterpreter m_instructions;
+	bool m_disableExternalCalls;
+	bool m_disableMemoryTrace;
+	/// Frames of all active functions, the current one last.
+	std::vector<u256> m_stack;
+	/// Index of the first slot of the current frame in m_stack.
+	size_t m_frameBase = 0;
+	/// Number of expression nodes evaluated so far in the current expression statement,
+	/// which is limited by InterpreterState::maxExprNesting.
+	size_t m_nestingLevel = 0;
+	/// Buffers for the arguments of active calls, indexed by m_argumentDepth.
+	/// A deque keeps them in place when a deeper call adds a buffer.
+	std::deque<std::vector<u256>> m_argumentBuffers;
+	size_t m_argumentDepth = 0;
+	/// Return values of the last function call.
+	std::vector<u256> m_returnValues;
+};
+
+}
+
+void CompiledInterpreter::run(
+	InterpreterState& _state,
+	Dialect const& _dialect,
+	Block const& _ast,
+	bool _disableExternalCalls,
+	bool _disableMemoryTracing
+)
+{
+	CompiledProgram program;
+	ProgramCompiler{_dialect, program}.run(_ast);
+	ProgramRunner{_state, program, _disableExternalCalls, _disableMemoryTracing}.run();
+}
@@ -0,0 +1,58 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Yul interpreter operating on a pre-resolved form of the AST.
+ */
+
+#pragma once
+
+#include <test/tools/yulInterpreter/Interpreter.h>
+
+#include <libyul/ASTForward.h>
+
+namespace solidity::yul
+{
+struct Dialect;
+}
+
+namespace solidity::yul::test
+{
+
+/**
+ * Yul interpreter that first translates the AST into a compact form in which variables are
+ * resolved to slots of the frame of their function, function calls to the called function and
+ * builtins to their definition, and then executes that form.
+ *
+ * It counts steps and expression nesting exactly like Interpreter and thus produces the same
+ * trace and state for the same limits, but avoids all name lookups and most allocations during
+ * execution. It is meant for the fuzzers, which interpret code in their inner loop.
+ */
+class CompiledInterpreter
+{
+public:
+	/// Executes @a _ast with the same semantics as Interpreter::run().
+	static void run(
+		InterpreterState& _state,
+		Dialect const& _dialect,
+		Block const& _ast,
+		bool _disableExternalCalls,
+		bool _disableMemoryTracing
+	);
+};
+
+}
@@ -33,12 +33,18 @@
 #include <liblangutil/SourceReferenceFormatter.h>
 
 #include <libyul/optimiser/Disambiguator.h>
+#include <libyul/optimiser/Metrics.h>
+#include <libyul/optimiser/NameSimplifier.h>
 #include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/optimiser/StackCompressor.h>
 #include <libyul/optimiser/VarNameCleaner.h>
 #include <libyul/optimiser/Suite.h>
 
 #include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/EVMMetrics.h>
+#include <libyul/YulStack.h>
+
+#include <liblangutil/DebugInfoSelection.h>
 
 #include <libsolutil/JSON.h>
 
@@ -59,6 +65,7 @@
 #include <range/v3/view/transform.hpp>
 
 #include <cctype>
+#include <iomanip>
 #include <string>
 #include <sstream>
 #include <iostream>
@@ -256,6 +263,140 @@ private:
 	};
 };
 
+/**
+ * Replays optimiser step sequences on a corpus of Yul objects and accumulates, per step,
+ * how much each invocation changes the code size, the code cost and the estimated gas costs.
+ */
+class StepScoreboard
+{
+public:
+	void addFile(string const& _path, string const& _steps, string const& _cleanupSteps)
+	{
+		YulStack stack(
+			EVMVersion{},
+			nullopt,
+			YulStack::Language::StrictAssembly,
+			OptimiserSettings::none(),
+			DebugInfoSelection::Default()
+		);
+		if (!stack.parseAndAnalyze(_path, readFileAsString(_path)))
+		{
+			SourceReferenceFormatter{cerr, stack, true, false}.printErrorInformation(stack.errors());
+			throw std::runtime_error("Could not parse or analyze " + _path + ".");
+		}
+		addObject(*stack.parserResult(), _steps, _cleanupSteps);
+	}
+
+	void print(ostream& _stream) const
+	{
+		size_t nameWidth = string("Step").size();
+		for (auto const& [name, impact]: m_impactPerStep)
+			nameWidth = std::max(nameWidth, name.size());
+
+		_stream << setiosflags(ios::left) << setw(static_cast<int>(nameWidth)) << "Step" << resetiosflags(ios::left);
+		for (char const* column: {"Runs", "Effective", "CodeSize", "CodeCost", "Gas"})
+			_stream << " " << setw(12) << column;
+		_stream << endl;
+		for (auto const& [name, impact]: m_impactPerStep)
+			_stream <<
+				setiosflags(ios::left) << setw(static_cast<int>(nameWidth)) << name << resetiosflags(ios::left) << " " <<
+				setw(12) << impact.runs << " " <<
+				setw(12) << impact.effectiveRuns << " " <<
+				setw(12) << impact.codeSize << " " <<
+				setw(12) << impact.codeCost << " " <<
+				setw(12) << impact.gas << endl;
+		_stream << endl << m_objectCount << " objects. ";
+		_stream << "Negative values are improvements. Gas is the GasMeter estimate of deploying and running all expressions once";
+		_stream << " (" << OptimiserSettings::standard().expectedExecutionsPerDeployment << " times for deployed objects)." << endl;
+	}
+
+private:
+	struct Metrics
+	{
+		bigint codeSize;
+		bigint codeCost;
+		bigint gas;
+	};
+
+	struct StepImpact
+	{
+		size_t runs = 0;
+		/// Number of runs that changed at least one of the metrics.
+		size_t effectiveRuns = 0;
+		bigint codeSize;
+		bigint codeCost;
+		bigint gas;
+	};
+
+	/// Sum of the GasMeter costs of all expressions in the code.
+	class GasSum: public ASTWalker
+	{
+	public:
+		explicit GasSum(GasMeter const& _meter): m_meter(_meter) {}
+		using ASTWalker::operator();
+		void visit(yul::Expression const& _expression) override { gas += m_meter.costs(_expression); }
+
+		bigint gas;
+
+	private:
+		GasMeter const& m_meter;
+	};
+
+	void addObject(Object const& _object, string const& _steps, string const& _cleanupSteps)
+	{
+		for (auto const& subNode: _object.subObjects)
+			if (auto subObject = dynamic_pointer_cast<Object>(subNode))
+				addObject(*subObject, _steps, _cleanupSteps);
+		if (!_object.code)
+			return;
+		++m_objectCount;
+
+		// Same setup as OptimiserSuite::run(), except that the stack compressor is not run.
+		bool isDeployed = boost::ends_with(_object.name.str(), "_deployed");
+		optional<size_t> expectedExecutionsPerDeployment;
+		if (isDeployed)
+			expectedExecutionsPerDeployment = OptimiserSettings::standard().expectedExecutionsPerDeployment;
+		GasMeter meter(m_dialect, !isDeployed, OptimiserSettings::standard().expectedExecutionsPerDeployment);
+
+		set<YulString> reservedIdentifiers = m_dialect.fixedFunctionNames();
+		yul::Block ast = std::get<yul::Block>(Disambiguator(m_dialect, *_object.analysisInfo, reservedIdentifiers)(*_object.code));
+		NameDispenser dispenser{m_dialect, ast, reservedIdentifiers};
+		OptimiserStepContext context{m_dialect, dispenser, reservedIdentifiers, expectedExecutionsPerDeployment};
+		OptimiserSuite suite{context};
+		suite.runSequence("hgfo", ast);
+		NameSimplifier::run(context, ast);
+
+		auto measure = [&](yul::Block const& _ast) {
+			GasSum gasSum{meter};
+			gasSum(_ast);
+			return Metrics{
+				CodeSize::codeSizeIncludingFunctions(_ast),
+				CodeCost::codeCost(m_dialect, _ast),
+				gasSum.gas
+			};
+		};
+		Metrics previous = measure(ast);
+		suite.setStepObserver([&](string const& _step, yul::Block const& _ast) {
+			Metrics current = measure(_ast);
+			StepImpact& impact = m_impactPerStep[_step];
+			++impact.runs;
+			if (current.codeSize != previous.codeSize || current.codeCost != previous.codeCost || current.gas != previous.gas)
+				++impact.effectiveRuns;
+			impact.codeSize += current.codeSize - previous.codeSize;
+			impact.codeCost += current.codeCost - previous.codeCost;
+			impact.gas += current.gas - previous.gas;
+			previous = std::move(current);
+		});
+		suite.runSequence(_steps, ast);
+		suite.runSequence("g", ast);
+		suite.runSequence(_cleanupSteps, ast);
+	}
+
+	EVMDialect const& m_dialect{EVMDialect::strictAssemblyForEVMObjects(EVMVersion{})};
+	map<string, StepImpact> m_impactPerStep;
+	size_t m_objectCount = 0;
+};
+
 int main(int argc, char** argv)
 {
 	try
@@ -268,6 +409,9 @@ int main(int argc, char** argv)
 	interactively read from stdin.
 	In non-interactive mode a list of steps has to be provided.
 	If <file> is -, yul code is read from stdin and run non-interactively.
+	With --steps-report, the steps (by default the default optimiser sequence) are
+	applied to each of the given files and the impact of every step on code size,
+	code cost and estimated gas is reported, aggregated over all files.
 
 	Allowed options)",
 			po::options_description::m_default_line_length,
@@ -288,6 +432,11 @@ int main(int argc, char** argv)
 				po::bool_switch(&nonInteractive)->default_value(false),
 				"stop after executing the provided steps"
 			)
+			(
+				"steps-report",
+				po::value<vector<string>>()->multitoken(),
+				"report the impact of every optimiser step on the given files (Yul objects or blocks)"
+			)
 			("help,h", "Show this help screen.");
 
 		// All positional options should be interpreted as input files
@@ -306,6 +455,27 @@ int main(int argc, char** argv)
 			return 0;
 		}
 
+		if (arguments.count("steps-report"))
+		{
+			string steps = OptimiserSettings::DefaultYulOptimiserSteps;
+			string cleanupSteps = OptimiserSettings::DefaultYulOptimiserCleanupSteps;
+			if (arguments.count("steps"))
+			{
+				steps = arguments["steps"].as<string>();
+				cleanupSteps.clear();
+				if (auto delimiter = steps.find(':'); delimiter != string::npos)
+				{
+					cleanupSteps = steps.substr(delimiter + 1);
+					steps.resize(delimiter);
+				}
+			}
+			StepScoreboard scoreboard;
+			for (string const& path: arguments["steps-report"].as<vector<string>>())
+				scoreboard.addFile(path, steps, cleanupSteps);
+			scoreboard.print(cout);
+			return 0;
+		}
+
 		string input;
 		if (arguments.count("input-file"))
 		{
@@ -0,0 +1,523 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Differential tester for the Yul optimiser: Applies optimiser steps and step sequences to a
+ * corpus of Yul code and compares the interpreter results of the original and the optimised code.
+ */
+
+#include <test/tools/ossfuzz/yulFuzzerCommon.h>
+
+#include <libyul/AST.h>
+#include <libyul/AsmAnalysisInfo.h>
+#include <libyul/AsmPrinter.h>
+#include <libyul/Object.h>
+#include <libyul/YulStack.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/Disambiguator.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/Suite.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+#include <liblangutil/EVMVersion.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+
+#include <boost/algorithm/string/join.hpp>
+#include <boost/exception/diagnostic_information.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::util;
+using namespace solidity::yul;
+using namespace solidity::yul::test::yul_fuzzer;
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+struct DiffOptions
+{
+	size_t randomSequences = 20;
+	size_t sequenceLength = 10;
+	unsigned seed = 0;
+	size_t maxSteps = 10000;
+	size_t maxTraceSize = 1000;
+	bool verbose = false;
+};
+
+struct FileResult
+{
+	size_t checkedSequences = 0;
+	size_t inconclusiveSequences = 0;
+	size_t failedSequences = 0;
+	std::string report;
+};
+
+/// The outcome of interpreting a piece of code.
+struct Execution
+{
+	std::string trace;
+	bool resourceLimitsExceeded = false;
+};
+
+Dialect const& dialect()
+{
+	return EVMDialect::strictAssemblyForEVMObjects(EVMVersion{});
+}
+
+Execution execute(std::shared_ptr<Block> const& _ast, DiffOptions const& _options)
+{
+	std::ostringstream trace;
+	// Memory tracing is disabled because e.g. the redundant store eliminator legitimately
+	// removes writes to memory that are never read.
+	yulFuzzerUtil::TerminationReason reason = yulFuzzerUtil::interpret(
+		trace,
+		_ast,
+		dialect(),
+		/*disableMemoryTracing=*/true,
+		/*outputStorageOnly=*/false,
+		_options.maxSteps,
+		_options.maxTraceSize
+	);
+	return {trace.str(), yulFuzzerUtil::resourceLimitsExceeded(reason)};
+}
+
+/// Names of all optimiser steps that can be run in the current environment.
+std::vector<std::string> availableSteps()
+{
+	std::vector<std::string> steps;
+	for (auto const& [name, step]: OptimiserSuite::allSteps())
+		if (!step->invalidInCurrentEnvironment())
+			steps.push_back(name);
+	return steps;
+}
+
+/// Copy of the code to which optimiser steps are applied one at a time.
+class SequenceRunner
+{
+public:
+	SequenceRunner(Block const& _ast, std::set<YulString> const& _reservedIdentifiers):
+		m_ast(std::make_shared<Block>(ASTCopier{}.translate(_ast))),
+		m_dispenser(dialect(), *m_ast, _reservedIdentifiers),
+		m_context{
+			dialect(),
+			m_dispenser,
+			_reservedIdentifiers,
+			frontend::OptimiserSettings::standard().expectedExecutionsPerDeployment
+		}
+	{}
+
+	void run(std::string const& _step) { OptimiserSuite{m_context}.runSequence(std::vector<std::string>{_step}, *m_ast); }
+	std::shared_ptr<Block> const& ast() const { return m_ast; }
+
+private:
+	std::shared_ptr<Block> m_ast;
+	NameDispenser m_dispenser;
+	OptimiserStepContext m_context;
+};
+
+std::string formatSequence(std::vector<std::string> const& _steps)
+{
+	return "[" + boost::algorithm::join(_steps, ", ") + "]";
+}
+
+/// Applies @a _steps to @a _input and compares the result with @a _reference.
+/// On a difference or an exception, the sequence is replayed step by step to find the first
+/// step that is responsible and a description is added to @a _result.
+void checkSequence(
+	Block const& _input,
+	std::set<YulString> const& _reservedIdentifiers,
+	Execution const& _reference,
+	std::vector<std::string> const& _steps,
+	DiffOptions const& _options,
+	FileResult& _result
+)
+{
+	std::ostringstream report;
+	try
+	{
+		SequenceRunner runner(_input, _reservedIdentifiers);
+		for (std::string const& step: _steps)
+			runner.run(step);
+		Execution optimised = execute(runner.ast(), _options);
+		if (optimised.resourceLimitsExceeded)
+		{
+			++_result.inconclusiveSequences;
+			return;
+		}
+		++_result.checkedSequences;
+		if (optimised.trace == _reference.trace)
+			return;
+
+		SequenceRunner replay(_input, _reservedIdentifiers);
+		size_t culprit = _steps.size() - 1;
+		Execution culpritExecution = optimised;
+		for (size_t index = 0; index + 1 < _steps.size(); ++index)
+		{
+			replay.run(_steps[index]);
+			Execution execution = execute(replay.ast(), _options);
+			if (!execution.resourceLimitsExceeded && execution.trace != _reference.trace)
+			{
+				culprit = index;
+				culpritExecution = std::move(execution);
+				break;
+			}
+		}
+		report << "Sequence " << formatSequence(_steps) << " changes the result. ";
+		report << "First difference after step " << culprit << " (" << _steps[culprit] << ")." << std::endl;
+		if (_options.verbose)
+		{
+			report << "Expected:" << std::endl << _reference.trace;
+			report << "Obtained:" << std::endl << culpritExecution.trace;
+			if (culprit == _steps.size() - 1)
+				report << "Optimised code:" << std::endl << AsmPrinter{dialect()}(*runner.ast()) << std::endl;
+			else
+				report << "Optimised code:" << std::endl << AsmPrinter{dialect()}(*replay.ast()) << std::endl;
+		}
+	}
+	catch (...)
+	{
+		++_result.checkedSequences;
+		report << "Sequence " << formatSequence(_steps) << " throws an exception:" << std::endl;
+		report << boost::current_exception_diagnostic_information() << std::endl;
+	}
+	++_result.failedSequences;
+	_result.report += report.str();
+}
+
+FileResult checkFile(
+	fs::path const& _path,
+	size_t _fileIndex,
+	std::vector<std::string> const& _steps,
+	DiffOptions const& _options
+)
+{
+	FileResult result;
+	YulStringRepository::reset();
+
+	YulStack stack(
+		EVMVersion{},
+		std::nullopt,
+		YulStack::Language::StrictAssembly,
+		frontend::OptimiserSettings::none(),
+		DebugInfoSelection::Default()
+	);
+	try
+	{
+		if (!stack.parseAndAnalyze(_path.string(), readFileAsString(_path)))
+		{
+			result.report = "Skipped: Could not parse or analyze the code.\n";
+			return result;
+		}
+	}
+	catch (...)
+	{
+		result.report = "Skipped: " + boost::current_exception_diagnostic_information() + "\n";
+		return result;
+	}
+
+	std::set<YulString> reservedIdentifiers = dialect().fixedFunctionNames();
+	// Same prefix as in OptimiserSuite::run(); some steps rely on it.
+	SequenceRunner prefix(
+		std::get<Block>(
+			Disambiguator(dialect(), *stack.parserResult()->analysisInfo, reservedIdentifiers)(*stack.parserResult()->code)
+		),
+		reservedIdentifiers
+	);
+	for (char const* step: {"FunctionHoister", "FunctionGrouper", "ForLoopInitRewriter"})
+		prefix.run(step);
+	Block const& input = *prefix.ast();
+
+	Execution reference = execute(prefix.ast(), _options);
+	if (reference.resourceLimitsExceeded)
+	{
+		result.report = "Skipped: The interpreter exceeds its resource limits on the unoptimised code.\n";
+		return result;
+	}
+
+	for (std::string const& step: _steps)
+		checkSequence(input, reservedIdentifiers, reference, {step}, _options, result);
+
+	// Seeded per file, so that the sequences do not depend on how files are distributed to workers.
+	std::mt19937 random(_options.seed + static_cast<unsigned>(_fileIndex));
+	std::uniform_int_distribution<size_t> stepDistribution(0, _steps.size() - 1);
+	for (size_t sequence = 0; sequence < _options.randomSequences; ++sequence)
+	{
+		std::vector<std::string> steps;
+		for (size_t index = 0; index < _options.sequenceLength; ++index)
+			steps.push_back(_steps[stepDistribution(random)]);
+		checkSequence(input, reservedIdentifiers, reference, steps, _options, result);
+	}
+	return result;
+}
+
+void writeResult(std::ostream& _stream, size_t _index, FileResult const& _result)
+{
+	_stream <<
+		_index << " " <<
+		_result.checkedSequences << " " <<
+		_result.inconclusiveSequences << " " <<
+		_result.failedSequences << " " <<
+		_result.report.size() << "\n" <<
+		_result.report;
+}
+
+bool readResult(std::istream& _stream, size_t& _index, FileResult& _result)
+{
+	size_t reportSize = 0;
+	if (!(
+		_stream >>
+		_index >>
+		_result.checkedSequences >>
+		_result.inconclusiveSequences >>
+		_result.failedSequences >>
+		reportSize
+	) || _stream.get() != '\n')
+		return false;
+	_result.report.assign(reportSize, '\0');
+	return static_cast<bool>(_stream.read(_result.report.data(), static_cast<std::streamsize>(reportSize)));
+}
+
+#if !defined(_WIN32)
+/// Checks the files in @a _jobs worker processes. Workers are processes rather than threads
+/// because the optimiser relies on the process-wide YulString repository and dialect caches.
+std::vector<FileResult> checkFilesInWorkers(
+	std::vector<fs::path> const& _files,
+	std::vector<std::string> const& _steps,
+	DiffOptions const& _options,
+	size_t _jobs
+)
+{
+	void* sharedMemory = mmap(nullptr, sizeof(std::atomic<size_t>), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (sharedMemory == MAP_FAILED)
+		BOOST_THROW_EXCEPTION(std::runtime_error("Could not allocate memory shared by the worker processes."));
+	auto* nextFile = new (sharedMemory) std::atomic<size_t>(0);
+
+	std::cout.flush();
+
+	std::vector<fs::path> resultFiles;
+	std::vector<pid_t> workers;
+	for (size_t worker = 0; worker < _jobs; ++worker)
+	{
+		resultFiles.emplace_back(fs::temp_directory_path() / fs::unique_path("yuloptidiff-%%%%-%%%%-%%%%-%%%%"));
+		pid_t pid = fork();
+		if (pid < 0)
+			BOOST_THROW_EXCEPTION(std::runtime_error("Could not start a worker process."));
+		if (pid == 0)
+		{
+			std::ofstream resultFile(resultFiles.back().string(), std::ios::binary);
+			for (size_t index = (*nextFile)++; index < _files.size(); index = (*nextFile)++)
+			{
+				writeResult(resultFile, index, checkFile(_files[index], index, _steps, _options));
+				resultFile.flush();
+			}
+			resultFile.close();
+			_exit(resultFile ? EXIT_SUCCESS : EXIT_FAILURE);
+		}
+		workers.push_back(pid);
+	}
+
+	for (pid_t pid: workers)
+		waitpid(pid, nullptr, 0);
+	munmap(sharedMemory, sizeof(std::atomic<size_t>));
+
+	FileResult crashed;
+	crashed.failedSequences = 1;
+	crashed.report = "Worker process terminated unexpectedly.\n";
+	std::vector<FileResult> results(_files.size(), crashed);
+	for (fs::path const& resultFilePath: resultFiles)
+	{
+		std::ifstream resultFile(resultFilePath.string(), std::ios::binary);
+		size_t index = 0;
+		FileResult result;
+		while (readResult(resultFile, index, result) && index < results.size())
+			results[index] = std::move(result);
+		resultFile.close();
+		fs::remove(resultFilePath);
+	}
+	return results;
+}
+#else
+std::vector<FileResult> checkFilesInWorkers(
+	std::vector<fs::path> const&,
+	std::vector<std::string> const&,
+	DiffOptions const&,
+	size_t
+)
+{
+	BOOST_THROW_EXCEPTION(std::runtime_error("Parallel execution is not supported on this platform."));
+}
+#endif
+
+std::vector<fs::path> collectFiles(std::vector<std::string> const& _paths)
+{
+	std::vector<fs::path> files;
+	for (std::string const& path: _paths)
+		if (fs::is_directory(path))
+		{
+			std::vector<fs::path> directoryFiles;
+			for (auto const& entry: fs::recursive_directory_iterator(path))
+				if (fs::is_regular_file(entry.path()) && entry.path().extension() == ".yul")
+					directoryFiles.push_back(entry.path());
+			std::sort(directoryFiles.begin(), directoryFiles.end());
+			files += directoryFiles;
+		}
+		else
+			files.emplace_back(path);
+	return files;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	DiffOptions diffOptions;
+	size_t jobs = 1;
+
+	po::options_description options(
+		R"(yuloptidiff, differential tester for the Yul optimiser.
+Usage: yuloptidiff [Options] <file or directory>...
+Applies every optimiser step and a number of random step sequences to each Yul file
+(or each .yul file in the given directories), runs the original and the optimised
+code in the Yul interpreter and reports step sequences that change the result,
+together with the first step after which the result differs.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("jobs,j", po::value<size_t>(&jobs)->default_value(jobs), "Number of worker processes.")
+		(
+			"random-sequences",
+			po::value<size_t>(&diffOptions.randomSequences)->default_value(diffOptions.randomSequences),
+			"Number of random step sequences applied to each file."
+		)
+		(
+			"sequence-length",
+			po::value<size_t>(&diffOptions.sequenceLength)->default_value(diffOptions.sequenceLength),
+			"Number of steps in each random sequence."
+		)
+		("seed", po::value<unsigned>(&diffOptions.seed)->default_value(diffOptions.seed), "Seed of the random sequences.")
+		(
+			"max-steps",
+			po::value<size_t>(&diffOptions.maxSteps)->default_value(diffOptions.maxSteps),
+			"Maximum number of interpreter steps. Results that exceed a limit are not compared."
+		)
+		(
+			"max-trace-size",
+			po::value<size_t>(&diffOptions.maxTraceSize)->default_value(diffOptions.maxTraceSize),
+			"Maximum number of entries in the interpreter trace."
+		)
+		("verbose", "Print the traces and the optimised code of differing results.")
+		("input", po::value<std::vector<std::string>>(), "Input files or directories.");
+	po::positional_options_description filesPositions;
+	filesPositions.add("input", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+		po::notify(arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		std::cerr << _exception.what() << std::endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("input"))
+	{
+		std::cout << options;
+		return arguments.count("help") ? 0 : 1;
+	}
+	if (jobs == 0)
+	{
+		std::cerr << "The number of jobs has to be positive." << std::endl;
+		return 1;
+	}
+	diffOptions.verbose = arguments.count("verbose");
+
+	std::vector<fs::path> files;
+	try
+	{
+		files = collectFiles(arguments["input"].as<std::vector<std::string>>());
+	}
+	catch (fs::filesystem_error const& _exception)
+	{
+		std::cerr << _exception.what() << std::endl;
+		return 1;
+	}
+
+	std::vector<std::string> steps = availableSteps();
+	std::vector<FileResult> results;
+	if (jobs > 1)
+		results = checkFilesInWorkers(files, steps, diffOptions, jobs);
+	else
+		for (size_t index = 0; index < files.size(); ++index)
+			results.emplace_back(checkFile(files[index], index, steps, diffOptions));
+
+	size_t checked = 0;
+	size_t inconclusive = 0;
+	size_t failed = 0;
+	for (size_t index = 0; index < files.size(); ++index)
+	{
+		if (!results[index].report.empty())
+			std::cout << files[index].string() << ":" << std::endl << results[index].report;
+		checked += results[index].checkedSequences;
+		inconclusive += results[index].inconclusiveSequences;
+		failed += results[index].failedSequences;
+	}
+	std::cout <<
+		files.size() << " files, " <<
+		checked << " sequences compared, " <<
+		inconclusive << " inconclusive due to resource limits, " <<
+		failed << " failed." << std::endl;
+
+	return failed == 0 ? 0 : 1;
+}